@@ -1,21 +1,52 @@
 #pragma once
 
 #include "detector.h"
+#include "vector_stats.h"
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
+//  ,        
+//    .    :
+// template <> struct IsTriviallyRelocatable<MyType> : std::true_type {};
 template <typename Type>
-class ArrayPtr 
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<Type>>
+{
+};
+
+template <typename Type>
+inline constexpr bool is_trivially_relocatable_v = IsTriviallyRelocatable<Type>::value;
+
+//         (realloc, mremap)
+template <typename Allocator, typename Type>
+concept ReallocatingAllocator = requires(Allocator& alloc, Type* ptr, size_t count)
+{
+    { alloc.reallocate(ptr, count, count) } -> std::same_as<Type*>;
+};
+
+//   ()    .
+//       ArrayPtr
+template <typename Type, typename Allocator = std::allocator<Type>>
+class ArrayPtr
 {
 public:
-    
+
+    using AllocTraits = std::allocator_traits<Allocator>;
+
     //   
-    ArrayPtr() = default; 
+    ArrayPtr() = default;
+
+    //      
+    explicit ArrayPtr(const Allocator& alloc) noexcept : allocator(alloc){}
 
-    //    
-    explicit ArrayPtr(size_t size)
+    //    size    
+    explicit ArrayPtr(size_t size, const Allocator& alloc = Allocator()) : allocator(alloc)
     {
         if (size == 0)
         {
@@ -23,66 +54,81 @@ public:
         }
         else
         {
-            raw_ptr = new Type[size];
+            raw_ptr = AllocTraits::allocate(allocator, size);
+            capacity = size;
+            VectorStats<Type>::allocated(size);
         }
     }
- 
-    //      
-    explicit ArrayPtr(Type* raw_ptr_) noexcept : raw_ptr(raw_ptr_){}
+
+    //    ,   alloc  capacity 
+    ArrayPtr(Type* raw_ptr_, size_t capacity_, const Allocator& alloc = Allocator()) noexcept
+        : allocator(alloc), raw_ptr(raw_ptr_), capacity(capacity_){}
 
     //  
     ArrayPtr(const ArrayPtr&) = delete;
 
     //  
-    ArrayPtr(ArrayPtr&& other) noexcept : raw_ptr(other.raw_ptr)
+    ArrayPtr(ArrayPtr&& other) noexcept : allocator(std::move(other.allocator)), raw_ptr(other.raw_ptr), capacity(other.capacity)
     {
         other.raw_ptr = nullptr;
+        other.capacity = 0;
     }
 
-    // 
-    ~ArrayPtr() 
+    //   ,       
+    ~ArrayPtr()
     {
-        //delete[] raw_ptr;
+        deallocate();
     }
 
     //  
     ArrayPtr& operator=(const ArrayPtr&) = delete;
 
-    //   
+    //   ,        
     ArrayPtr& operator=(ArrayPtr&& other) noexcept
     {
         if (this != &other)
         {
-            delete[] raw_ptr;
-            raw_ptr = other.raw_ptr;
-            other.raw_ptr = nullptr;
+            deallocate();
+
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+            {
+                allocator = std::move(other.allocator);
+            }
+            else
+            {
+                assert(allocator == other.allocator);
+            }
+
+            raw_ptr = std::exchange(other.raw_ptr, nullptr);
+            capacity = std::exchange(other.capacity, 0);
         }
         return *this;
     }
 
-    //      
-    Type* release() noexcept 
+    //      
+    Type* release() noexcept
     {
         Type* tmp = raw_ptr;
         raw_ptr = nullptr;
+        capacity = 0;
         return tmp;
-        
+
     }
 
     //     O(1)
-    Type& operator[](size_t index) noexcept 
+    Type& operator[](size_t index) noexcept
     {
         return raw_ptr[index];
     }
 
     //      O(1)
-    const Type& operator[](size_t index) const noexcept 
+    const Type& operator[](size_t index) const noexcept
     {
         return raw_ptr[index];
     }
 
-    //     O(1)
-    explicit operator bool() const 
+    //     O(1)
+    explicit operator bool() const
     {
         if (raw_ptr)
         {
@@ -92,18 +138,208 @@ public:
     }
 
     //    O(1)
-    Type* get() const noexcept 
+    Type* get() const noexcept
     {
         return raw_ptr;
     }
 
-    //   O(1)
-    void swap(ArrayPtr& other) noexcept 
+    //  ,     O(1)
+    size_t get_capacity() const noexcept
     {
+        return capacity;
+    }
+
+    // ,    O(1)
+    const Allocator& get_allocator() const noexcept
+    {
+        return allocator;
+    }
+
+    //          
+    static constexpr bool can_reallocate = is_trivially_relocatable_v<Type> && ReallocatingAllocator<Allocator, Type>;
+
+    //        ,   can_reallocate O(N)
+    void reallocate(size_t new_capacity) requires can_reallocate
+    {
+        if (new_capacity == 0)
+        {
+            deallocate();
+            raw_ptr = nullptr;
+        }
+        else if (raw_ptr)
+        {
+            raw_ptr = allocator.reallocate(raw_ptr, capacity, new_capacity);
+        }
+        else
+        {
+            raw_ptr = AllocTraits::allocate(allocator, new_capacity);
+        }
+        capacity = new_capacity;
+
+        if (new_capacity != 0)
+        {
+            VectorStats<Type>::allocated(new_capacity);
+        }
+    }
+
+    //   O(1)
+    void swap(ArrayPtr& other) noexcept
+    {
+        if constexpr (AllocTraits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(allocator, other.allocator);
+        }
+        else
+        {
+            assert(allocator == other.allocator);
+        }
+
         std::swap(other.raw_ptr, raw_ptr);
+        std::swap(other.capacity, capacity);
+    }
+
+//-------------------------------------------------    ----------------------------------------------------------------
+
+    //     place,        O(1)
+    template <typename... Args>
+    void construct(Type* place, Args&&... args)
+    {
+        AllocTraits::construct(allocator, place, std::forward<Args>(args)...);
+
+        if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, Type> && ...))
+        {
+            if constexpr ((std::is_rvalue_reference_v<Args&&> && ...))
+            {
+                VectorStats<Type>::moved(1);
+            }
+            else
+            {
+                VectorStats<Type>::copied(1);
+            }
+        }
+    }
+
+    //   [first, last) O(N)
+    void destroy(Type* first, Type* last) noexcept
+    {
+        for (; first != last; ++first)
+        {
+            AllocTraits::destroy(allocator, first);
+        }
+    }
+
+    //  [first, last)    dest,     O(N)
+    template <typename InputIterator, typename Sentinel>
+    Type* uninitialized_copy(InputIterator first, Sentinel last, Type* dest)
+    {
+        Type* current = dest;
+        try
+        {
+            for (; first != last; ++first, ++current)
+            {
+                construct(current, *first);
+            }
+        }
+        catch (...)
+        {
+            destroy(dest, current);
+            throw;
+        }
+        return current;
+    }
+
+    //  [first, last)    dest O(N)
+    Type* uninitialized_move(Type* first, Type* last, Type* dest)
+    {
+        return uninitialized_copy(std::make_move_iterator(first), std::make_move_iterator(last), dest);
+    }
+
+    //  [first, last)  dest,         ,
+    //  :       (move_if_noexcept) O(N)
+    Type* uninitialized_move_if_noexcept(Type* first, Type* last, Type* dest)
+    {
+        if constexpr (std::is_nothrow_move_constructible_v<Type> || !std::is_copy_constructible_v<Type>)
+        {
+            return uninitialized_move(first, last, dest);
+        }
+        else
+        {
+            return uninitialized_copy(first, last, dest);
+        }
+    }
+
+    //  [first, last)    dest,   .
+    //       memcpy O(N)
+    Type* uninitialized_relocate(Type* first, Type* last, Type* dest)
+    {
+        if constexpr (is_trivially_relocatable_v<Type>)
+        {
+            if (first != last)
+            {
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(Type));
+            }
+            VectorStats<Type>::relocated(last - first);
+            return dest + (last - first);
+        }
+        else
+        {
+            Type* result = uninitialized_move_if_noexcept(first, last, dest);
+            destroy(first, last);
+            return result;
+        }
+    }
+
+    //  count  value    dest O(N)
+    Type* uninitialized_fill(Type* dest, size_t count, const Type& value)
+    {
+        Type* current = dest;
+        try
+        {
+            for (; count > 0; --count, ++current)
+            {
+                construct(current, value);
+            }
+        }
+        catch (...)
+        {
+            destroy(dest, current);
+            throw;
+        }
+        return current;
+    }
+
+    //  count       dest O(N)
+    Type* uninitialized_value_construct(Type* dest, size_t count)
+    {
+        Type* current = dest;
+        try
+        {
+            for (; count > 0; --count, ++current)
+            {
+                construct(current);
+            }
+        }
+        catch (...)
+        {
+            destroy(dest, current);
+            throw;
+        }
+        return current;
     }
 
 private:
 
+    [[no_unique_address]] Allocator allocator;
     Type* raw_ptr = nullptr;
-};
\ No newline at end of file
+    size_t capacity = 0;
+
+    //       O(1)
+    void deallocate() noexcept
+    {
+        if (raw_ptr)
+        {
+            AllocTraits::deallocate(allocator, raw_ptr, capacity);
+        }
+    }
+};
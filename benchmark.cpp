@@ -0,0 +1,70 @@
+#include "benchmark.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+//    --name=value  nullptr,  argument   
+const char* OptionValue(const std::string& argument, const std::string& name)
+{
+	std::string prefix = "--" + name + "=";
+	return argument.compare(0, prefix.size(), prefix) == 0 ? argument.c_str() + prefix.size() : nullptr;
+}
+
+//    : --max-size=1e8
+size_t ParseSize(const char* value)
+{
+	return static_cast<size_t>(std::strtod(value, nullptr));
+}
+
+int main(int argc, char* argv[])
+{
+	BenchmarkOptions options;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument = argv[i];
+
+		if (const char* value = OptionValue(argument, "min-size"))
+		{
+			options.min_size = ParseSize(value);
+		}
+		else if (const char* value = OptionValue(argument, "max-size"))
+		{
+			options.max_size = ParseSize(value);
+		}
+		else if (const char* value = OptionValue(argument, "quadratic-max-size"))
+		{
+			options.quadratic_max_size = ParseSize(value);
+		}
+		else if (const char* value = OptionValue(argument, "max-bytes"))
+		{
+			options.max_bytes = ParseSize(value);
+		}
+		else if (const char* value = OptionValue(argument, "min-time"))
+		{
+			options.min_time = std::strtod(value, nullptr);
+		}
+		else if (const char* value = OptionValue(argument, "filter"))
+		{
+			options.filter = value;
+		}
+		else if (argument == "--csv")
+		{
+			options.csv = true;
+		}
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--min-size=N] [--max-size=N] [--quadratic-max-size=N] [--max-bytes=N]"
+				" [--min-time=SECONDS] [--filter=SUBSTRING] [--csv]" << std::endl;
+			return 1;
+		}
+	}
+
+	RunAllBenchmarks(options);
+
+#if defined(SIMPLE_VECTOR_STATS)
+	std::cout << std::endl;
+	VectorStatsRegistry::report(std::cout);
+#endif
+}
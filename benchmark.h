@@ -0,0 +1,748 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//   SimpleVector  std::vector   .   
+// BenchmarkAllocator,        
+
+//=====================================================================    =============================================================
+
+//  ,   
+struct BenchmarkCounters
+{
+    inline static size_t allocations = 0;
+    inline static size_t allocated_bytes = 0;
+    inline static size_t transfers = 0;     //     
+};
+
+//   std::allocator,   
+template <typename Type>
+class BenchmarkAllocator
+{
+public:
+
+    using value_type = Type;
+    using is_always_equal = std::true_type;
+
+    BenchmarkAllocator() noexcept = default;
+
+    template <typename Other>
+    BenchmarkAllocator(const BenchmarkAllocator<Other>&) noexcept {}
+
+    //    count  O(1)
+    Type* allocate(size_t count)
+    {
+        ++BenchmarkCounters::allocations;
+        BenchmarkCounters::allocated_bytes += count * sizeof(Type);
+        return std::allocator<Type>().allocate(count);
+    }
+
+    //    count  O(1)
+    void deallocate(Type* ptr, size_t count) noexcept
+    {
+        std::allocator<Type>().deallocate(ptr, count);
+    }
+
+    template <typename Other>
+    bool operator==(const BenchmarkAllocator<Other>&) const noexcept
+    {
+        return true;
+    }
+};
+
+//=======================================================================   ==================================================================
+
+//     64 
+struct Pod64
+{
+    uint64_t key;
+    char payload[56];
+};
+
+inline bool operator==(const Pod64& lhs, const Pod64& rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(Pod64)) == 0;
+}
+
+inline bool operator<(const Pod64& lhs, const Pod64& rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(Pod64)) < 0;
+}
+
+//   ,    
+class MoveOnly
+{
+public:
+
+    MoveOnly() noexcept = default;
+
+    explicit MoveOnly(int value) noexcept : value(value) {}
+
+    MoveOnly(const MoveOnly&) = delete;
+    MoveOnly& operator=(const MoveOnly&) = delete;
+
+    MoveOnly(MoveOnly&& other) noexcept : value(std::exchange(other.value, 0))
+    {
+        ++BenchmarkCounters::transfers;
+    }
+
+    MoveOnly& operator=(MoveOnly&& other) noexcept
+    {
+        value = std::exchange(other.value, 0);
+        ++BenchmarkCounters::transfers;
+        return *this;
+    }
+
+    int get() const noexcept
+    {
+        return value;
+    }
+
+private:
+
+    int value = 0;
+};
+
+inline bool operator==(const MoveOnly& lhs, const MoveOnly& rhs)
+{
+    return lhs.get() == rhs.get();
+}
+
+inline bool operator<(const MoveOnly& lhs, const MoveOnly& rhs)
+{
+    return lhs.get() < rhs.get();
+}
+
+//      ,      
+template <typename Type>
+inline constexpr bool counts_transfers = std::is_same_v<Type, MoveOnly>;
+
+//     
+template <typename Type> const char* ElementName();
+template <> inline const char* ElementName<int>() { return "int"; }
+template <> inline const char* ElementName<std::string>() { return "string"; }
+template <> inline const char* ElementName<Pod64>() { return "pod64"; }
+template <> inline const char* ElementName<MoveOnly>() { return "move_only"; }
+
+//     index,   SSO,     
+template <typename Type>
+Type MakeValue(size_t index)
+{
+    if constexpr (std::is_same_v<Type, std::string>)
+    {
+        return std::string(32, 'a' + static_cast<char>(index % 26)) + std::to_string(index);
+    }
+    else if constexpr (std::is_same_v<Type, Pod64>)
+    {
+        Pod64 value{};
+        value.key = index;
+        std::memset(value.payload, static_cast<int>(index & 0xFF), sizeof(value.payload));
+        return value;
+    }
+    else
+    {
+        return Type(static_cast<int>(index));
+    }
+}
+
+//   count  O(N)
+template <typename Type>
+std::vector<Type> MakeValues(size_t count)
+{
+    std::vector<Type> values;
+    values.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        values.push_back(MakeValue<Type>(i));
+    }
+    return values;
+}
+
+//=================================================================    =============================================================
+
+template <typename Type>
+using BenchmarkSimpleVector = SimpleVector<Type, BenchmarkAllocator<Type>>;
+
+template <typename Type>
+using BenchmarkStdVector = std::vector<Type, BenchmarkAllocator<Type>>;
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+size_t ContainerSize(const SimpleVector<Type, Allocator, GrowthPolicy>& container)
+{
+    return container.get_size();
+}
+
+template <typename Type, typename Allocator>
+size_t ContainerSize(const std::vector<Type, Allocator>& container)
+{
+    return container.size();
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename Iterator>
+void AppendRange(SimpleVector<Type, Allocator, GrowthPolicy>& container, Iterator first, Iterator last)
+{
+    container.append_range(first, last);
+}
+
+template <typename Type, typename Allocator, typename Iterator>
+void AppendRange(std::vector<Type, Allocator>& container, Iterator first, Iterator last)
+{
+    container.insert(container.end(), first, last);
+}
+
+template <typename Type> const char* ContainerName(const BenchmarkSimpleVector<Type>*) { return "SimpleVector"; }
+template <typename Type> const char* ContainerName(const BenchmarkStdVector<Type>*) { return "std::vector"; }
+
+//=========================================================================  ====================================================================
+
+//      value
+template <typename Type>
+inline void DoNotOptimize(const Type& value)
+{
+#if defined(_MSC_VER)
+    static const void* volatile sink;
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+//  
+struct BenchmarkOptions
+{
+    size_t min_size = 10;
+    size_t max_size = 1000000;
+    size_t quadratic_max_size = 10000;      //    O(N^2):      
+    size_t max_bytes = size_t(1) << 30;     //      
+    double min_time = 0.1;                  //     
+    std::string filter;
+    bool csv = false;
+};
+
+//   .     ,    
+//       ,        
+class BenchmarkState
+{
+public:
+
+    using Clock = std::chrono::steady_clock;
+
+    //      O(1)
+    void resume()
+    {
+        allocations -= BenchmarkCounters::allocations;
+        transfers -= BenchmarkCounters::transfers;
+        start = Clock::now();
+    }
+
+    //      O(1)
+    void pause()
+    {
+        elapsed += Clock::now() - start;
+        allocations += BenchmarkCounters::allocations;
+        transfers += BenchmarkCounters::transfers;
+    }
+
+    double get_seconds() const
+    {
+        return std::chrono::duration<double>(elapsed).count();
+    }
+
+    double get_nanoseconds() const
+    {
+        return std::chrono::duration<double, std::nano>(elapsed).count();
+    }
+
+    size_t get_allocations() const
+    {
+        return allocations;
+    }
+
+    size_t get_transfers() const
+    {
+        return transfers;
+    }
+
+private:
+
+    Clock::time_point start;
+    Clock::duration elapsed = Clock::duration::zero();
+    size_t allocations = 0;
+    size_t transfers = 0;
+};
+
+//   
+struct BenchmarkResult
+{
+    std::string name;
+    std::string container;
+    size_t size = 0;
+    double ns_per_op = 0;
+    double allocations_per_op = 0;
+    double bytes_moved_per_op = -1;         //  ,    
+};
+
+//        ,    
+//          O(1)
+inline size_t BatchCount(size_t size)
+{
+    return std::max<size_t>(1, 16384 / std::max<size_t>(size, 1));
+}
+
+//  body(state),   ,      min_time O(T)
+template <typename Type, typename Body>
+BenchmarkResult Measure(const std::string& name, const char* container, size_t size, const BenchmarkOptions& options, Body body)
+{
+    BenchmarkState state;
+    size_t operations = 0;
+    auto wall_start = BenchmarkState::Clock::now();
+
+    do
+    {
+        operations += body(state);
+    }
+    while (state.get_seconds() < options.min_time
+        && std::chrono::duration<double>(BenchmarkState::Clock::now() - wall_start).count() < 10 * options.min_time);
+
+    BenchmarkResult result;
+    result.name = name;
+    result.container = container;
+    result.size = size;
+    result.ns_per_op = state.get_nanoseconds() / operations;
+    result.allocations_per_op = static_cast<double>(state.get_allocations()) / operations;
+    if (counts_transfers<Type>)
+    {
+        result.bytes_moved_per_op = static_cast<double>(state.get_transfers()) * sizeof(Type) / operations;
+    }
+    return result;
+}
+
+//=========================================================================  =====================================================================
+
+//       batch     
+//  :      ,    -  
+
+// push_back      
+template <typename Container, typename Type>
+size_t BenchPushBackCopy(BenchmarkState& state, const std::vector<Type>& source)
+{
+    std::vector<Container> containers(BatchCount(source.size()));
+
+    state.resume();
+    for (Container& container : containers)
+    {
+        for (const Type& value : source)
+        {
+            container.push_back(value);
+        }
+    }
+    state.pause();
+
+    DoNotOptimize(containers);
+    return containers.size() * source.size();
+}
+
+// push_back       
+template <typename Container, typename Type>
+size_t BenchPushBackMove(BenchmarkState& state, size_t size)
+{
+    std::vector<Container> containers(BatchCount(size));
+    std::vector<std::vector<Type>> values;
+    for (size_t i = 0; i < containers.size(); ++i)
+    {
+        values.push_back(MakeValues<Type>(size));
+    }
+
+    state.resume();
+    for (size_t i = 0; i < containers.size(); ++i)
+    {
+        for (Type& value : values[i])
+        {
+            containers[i].push_back(std::move(value));
+        }
+    }
+    state.pause();
+
+    DoNotOptimize(containers);
+    return containers.size() * size;
+}
+
+//      position( )
+template <typename Container, typename Type, typename Position>
+size_t BenchInsert(BenchmarkState& state, size_t size, Position position)
+{
+    std::vector<Container> containers(BatchCount(size));
+    std::vector<std::vector<Type>> values;
+    for (size_t i = 0; i < containers.size(); ++i)
+    {
+        values.push_back(MakeValues<Type>(size));
+    }
+
+    state.resume();
+    for (size_t i = 0; i < containers.size(); ++i)
+    {
+        Container& container = containers[i];
+        for (Type& value : values[i])
+        {
+            container.insert(container.begin() + position(ContainerSize(container)), std::move(value));
+        }
+    }
+    state.pause();
+
+    DoNotOptimize(containers);
+    return containers.size() * size;
+}
+
+//     ,    
+template <typename Container, typename Type>
+size_t BenchErase(BenchmarkState& state, size_t size)
+{
+    std::vector<Container> containers(BatchCount(size));
+    for (Container& container : containers)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            container.push_back(MakeValue<Type>(i));
+        }
+    }
+
+    state.resume();
+    for (Container& container : containers)
+    {
+        while (ContainerSize(container) > 0)
+        {
+            container.erase(container.begin() + ContainerSize(container) / 2);
+        }
+    }
+    state.pause();
+
+    DoNotOptimize(containers);
+    return containers.size() * size;
+}
+
+// resize    size 
+template <typename Container>
+size_t BenchResize(BenchmarkState& state, size_t size)
+{
+    std::vector<Container> containers(BatchCount(size));
+
+    state.resume();
+    for (Container& container : containers)
+    {
+        container.resize(size);
+    }
+    state.pause();
+
+    DoNotOptimize(containers);
+    return containers.size() * size;
+}
+
+// reserve    ,     
+template <typename Container, typename Type>
+size_t BenchReservePushBack(BenchmarkState& state, size_t size)
+{
+    std::vector<Container> containers(BatchCount(size));
+    std::vector<std::vector<Type>> values;
+    for (size_t i = 0; i < containers.size(); ++i)
+    {
+        values.push_back(MakeValues<Type>(size));
+    }
+
+    state.resume();
+    for (size_t i = 0; i < containers.size(); ++i)
+    {
+        containers[i].reserve(size);
+        for (Type& value : values[i])
+        {
+            containers[i].push_back(std::move(value));
+        }
+    }
+    state.pause();
+
+    DoNotOptimize(containers);
+    return containers.size() * size;
+}
+
+//     ,     move_iterator
+template <typename Container, typename Type>
+size_t BenchAppendRange(BenchmarkState& state, size_t size)
+{
+    std::vector<Container> containers(BatchCount(size));
+    std::vector<std::vector<Type>> values;
+    for (size_t i = 0; i < containers.size(); ++i)
+    {
+        values.push_back(MakeValues<Type>(size));
+    }
+
+    state.resume();
+    for (size_t i = 0; i < containers.size(); ++i)
+    {
+        if constexpr (std::is_copy_constructible_v<Type>)
+        {
+            AppendRange(containers[i], values[i].begin(), values[i].end());
+        }
+        else
+        {
+            AppendRange(containers[i], std::make_move_iterator(values[i].begin()), std::make_move_iterator(values[i].end()));
+        }
+    }
+    state.pause();
+
+    DoNotOptimize(containers);
+    return containers.size() * size;
+}
+
+//    size 
+template <typename Container, typename Type>
+Container MakeContainer(size_t size)
+{
+    Container container;
+    container.reserve(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        container.push_back(MakeValue<Type>(i));
+    }
+    return container;
+}
+
+//  
+template <typename Container, typename Type>
+size_t BenchCopyConstruct(BenchmarkState& state, size_t size)
+{
+    size_t batch = BatchCount(size);
+    Container source = MakeContainer<Container, Type>(size);
+    std::vector<std::optional<Container>> copies(batch);
+
+    state.resume();
+    for (std::optional<Container>& copy : copies)
+    {
+        copy.emplace(source);
+    }
+    state.pause();
+
+    DoNotOptimize(copies);
+    return batch * size;
+}
+
+//  ,     
+template <typename Container, typename Type>
+size_t BenchMoveConstruct(BenchmarkState& state, size_t size)
+{
+    size_t batch = BatchCount(size);
+    std::vector<Container> sources;
+    for (size_t i = 0; i < batch; ++i)
+    {
+        sources.push_back(MakeContainer<Container, Type>(size));
+    }
+    std::vector<std::optional<Container>> targets(batch);
+
+    state.resume();
+    for (size_t i = 0; i < batch; ++i)
+    {
+        targets[i].emplace(std::move(sources[i]));
+    }
+    state.pause();
+
+    DoNotOptimize(targets);
+    return batch;
+}
+
+//   ,     ,  differ
+template <typename Container, typename Type, typename Compare>
+size_t BenchCompare(BenchmarkState& state, size_t size, bool differ, Compare compare)
+{
+    size_t batch = BatchCount(size);
+    Container lhs = MakeContainer<Container, Type>(size);
+    Container rhs = MakeContainer<Container, Type>(size);
+    if (differ && size > 0)
+    {
+        rhs[size - 1] = MakeValue<Type>(size);
+    }
+    size_t matches = 0;
+
+    state.resume();
+    for (size_t i = 0; i < batch; ++i)
+    {
+        DoNotOptimize(lhs);
+        matches += compare(lhs, rhs);
+    }
+    state.pause();
+
+    DoNotOptimize(matches);
+    return batch * size;
+}
+
+//==========================================================================  =======================================================================
+
+//   :  SimpleVector    std::vector
+inline void PrintResult(const BenchmarkResult& result, const BenchmarkResult* baseline, const BenchmarkOptions& options)
+{
+    char moved[32] = "-";
+    if (result.bytes_moved_per_op >= 0)
+    {
+        std::snprintf(moved, sizeof(moved), "%.1f", result.bytes_moved_per_op);
+    }
+    char speedup[32] = "";
+    if (baseline && result.ns_per_op > 0)
+    {
+        std::snprintf(speedup, sizeof(speedup), "%.2fx", baseline->ns_per_op / result.ns_per_op);
+    }
+
+    std::string name = result.name + "/" + result.container + "/" + std::to_string(result.size);
+    if (options.csv)
+    {
+        std::printf("%s,%s,%zu,%.3f,%.4f,%s,%s\n", result.name.c_str(), result.container.c_str(), result.size,
+            result.ns_per_op, result.allocations_per_op, moved, speedup);
+    }
+    else
+    {
+        std::printf("%-52s %12.3f %12.4f %12s %8s\n", name.c_str(), result.ns_per_op, result.allocations_per_op, moved, speedup);
+    }
+    std::fflush(stdout);
+}
+
+//    std::vector,   SimpleVector    . run(container_tag, state) 
+//  ,  container_tag -     
+template <typename Type, typename Run>
+void RunPair(const std::string& operation, size_t size, const BenchmarkOptions& options, Run run)
+{
+    std::string name = operation + "<" + ElementName<Type>() + ">";
+    if (!options.filter.empty() && name.find(options.filter) == std::string::npos)
+    {
+        return;
+    }
+
+    auto measure = [&](auto* tag)
+    {
+        return Measure<Type>(name, ContainerName<Type>(tag), size, options, [&](BenchmarkState& state) { return run(tag, state); });
+    };
+
+    BenchmarkResult baseline = measure(static_cast<BenchmarkStdVector<Type>*>(nullptr));
+    PrintResult(baseline, nullptr, options);
+
+    BenchmarkResult result = measure(static_cast<BenchmarkSimpleVector<Type>*>(nullptr));
+    PrintResult(result, &baseline, options);
+}
+
+//         
+template <typename Type>
+void RunBenchmarks(size_t size, const BenchmarkOptions& options)
+{
+    if (size * sizeof(Type) * 3 > options.max_bytes)
+    {
+        return;
+    }
+
+    constexpr bool copyable = std::is_copy_constructible_v<Type>;
+    const bool quadratic = size <= options.quadratic_max_size;
+
+    std::vector<Type> source;
+    if constexpr (copyable)
+    {
+        source = MakeValues<Type>(size);
+        RunPair<Type>("push_back_copy", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+        {
+            return BenchPushBackCopy<Container>(state, source);
+        });
+    }
+
+    RunPair<Type>("push_back_move", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+    {
+        return BenchPushBackMove<Container, Type>(state, size);
+    });
+
+    RunPair<Type>("insert_back", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+    {
+        return BenchInsert<Container, Type>(state, size, [](size_t current) { return current; });
+    });
+
+    if (quadratic)
+    {
+        RunPair<Type>("insert_middle", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+        {
+            return BenchInsert<Container, Type>(state, size, [](size_t current) { return current / 2; });
+        });
+
+        RunPair<Type>("insert_front", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+        {
+            return BenchInsert<Container, Type>(state, size, [](size_t) { return size_t(0); });
+        });
+
+        RunPair<Type>("erase_middle", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+        {
+            return BenchErase<Container, Type>(state, size);
+        });
+    }
+
+    RunPair<Type>("resize", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+    {
+        return BenchResize<Container>(state, size);
+    });
+
+    RunPair<Type>("reserve_push_back", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+    {
+        return BenchReservePushBack<Container, Type>(state, size);
+    });
+
+    RunPair<Type>("append_range", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+    {
+        return BenchAppendRange<Container, Type>(state, size);
+    });
+
+    if constexpr (copyable)
+    {
+        RunPair<Type>("copy_construct", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+        {
+            return BenchCopyConstruct<Container, Type>(state, size);
+        });
+    }
+
+    RunPair<Type>("move_construct", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+    {
+        return BenchMoveConstruct<Container, Type>(state, size);
+    });
+
+    RunPair<Type>("compare_equal", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+    {
+        return BenchCompare<Container, Type>(state, size, false, [](const Container& a, const Container& b) { return a == b; });
+    });
+
+    RunPair<Type>("compare_less", size, options, [&]<typename Container>(Container*, BenchmarkState& state)
+    {
+        return BenchCompare<Container, Type>(state, size, true, [](const Container& a, const Container& b) { return a < b; });
+    });
+}
+
+//       min_size, 10 * min_size, ...  max_size
+inline void RunAllBenchmarks(const BenchmarkOptions& options)
+{
+    if (options.csv)
+    {
+        std::printf("benchmark,container,size,ns_per_op,allocations_per_op,bytes_moved_per_op,speedup\n");
+    }
+    else
+    {
+        std::printf("%-52s %12s %12s %12s %8s\n", "Benchmark", "ns/op", "allocs/op", "moved B/op", "vs std");
+        std::printf("%s\n", std::string(100, '-').c_str());
+    }
+
+    for (size_t size = std::max<size_t>(options.min_size, 1); size <= options.max_size; size *= 10)
+    {
+        RunBenchmarks<int>(size, options);
+        RunBenchmarks<std::string>(size, options);
+        RunBenchmarks<Pod64>(size, options);
+        RunBenchmarks<MoveOnly>(size, options);
+    }
+}
@@ -0,0 +1,821 @@
+#pragma once
+
+#include "simple_vector.h"
+#include "simple_vector_view.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+//        .        
+//  ,        ,   
+//        .   kChunkSize  -    
+// ChunkBytes ,           . ,   std::deque,
+//      
+template <typename Type, typename Allocator = std::allocator<Type>, size_t ChunkBytes = 64 * 1024>
+class ChunkedSimpleVector
+{
+    using AllocTraits = std::allocator_traits<Allocator>;
+    using Chunk = ArrayPtr<Type, Allocator>;
+    using ChunkAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;
+
+public:
+
+    static constexpr size_t kChunkSize = std::bit_floor(std::max<size_t>(1, ChunkBytes / sizeof(Type)));
+    static constexpr size_t kChunkShift = std::countr_zero(kChunkSize);
+    static constexpr size_t kChunkMask = kChunkSize - 1;
+
+    template <bool IsConst>
+    class ChunkedIterator;
+
+    using Iterator = ChunkedIterator<false>;
+    using ConstIterator = ChunkedIterator<true>;
+    using allocator_type = Allocator;
+
+//=====================================================================    ==========================================================
+
+    ChunkedSimpleVector() noexcept = default;
+
+    explicit ChunkedSimpleVector(const Allocator& alloc) noexcept : chunks(ChunkAllocator(alloc)), allocator(alloc){}
+
+    //    size   
+    explicit ChunkedSimpleVector(size_t size, const Allocator& alloc = Allocator()) : ChunkedSimpleVector(alloc)
+    {
+        resize(size);
+    }
+
+    //    size  value
+    ChunkedSimpleVector(size_t size, const Type& value, const Allocator& alloc = Allocator()) : ChunkedSimpleVector(alloc)
+    {
+        reserve(size);
+        append_filled(size, value);
+    }
+
+    //     {}
+    ChunkedSimpleVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator()) : ChunkedSimpleVector(alloc)
+    {
+        reserve(init.size());
+        append_range(init.begin(), init.end());
+    }
+
+    //      
+    explicit ChunkedSimpleVector(ReserveProxyObj obj, const Allocator& alloc = Allocator()) : ChunkedSimpleVector(alloc)
+    {
+        reserve(obj.get_capacity());
+    }
+
+    //  ,       O(N)
+    ChunkedSimpleVector(const ChunkedSimpleVector& other)
+        : ChunkedSimpleVector(other, AllocTraits::select_on_container_copy_construction(other.allocator)){}
+
+    //      O(N)
+    ChunkedSimpleVector(const ChunkedSimpleVector& other, const Allocator& alloc) : ChunkedSimpleVector(alloc)
+    {
+        reserve(other.size);
+        append_range(other.begin(), other.end());
+    }
+
+    //      O(1)
+    ChunkedSimpleVector(ChunkedSimpleVector&& other) noexcept
+        : chunks(std::move(other.chunks)), allocator(other.allocator), size(std::exchange(other.size, 0)){}
+
+    //     .       O(1),
+    //         O(N)
+    ChunkedSimpleVector(ChunkedSimpleVector&& other, const Allocator& alloc) : ChunkedSimpleVector(alloc)
+    {
+        if (alloc == other.allocator)
+        {
+            chunks.swap(other.chunks);
+            std::swap(size, other.size);
+            return;
+        }
+
+        //     ,   i    i
+        reserve(other.size);
+        for (size_t i = 0; i < other.get_chunk_count(); ++i)
+        {
+            SimpleVectorView<Type> part = other.chunk(i);
+            chunks[i].uninitialized_move(part.begin(), part.end(), chunks[i].get());
+            size += part.get_size();
+        }
+    }
+
+    //   ,    O(N)
+    ~ChunkedSimpleVector()
+    {
+        VectorStats<Type>::released(get_capacity(), size);
+        destroy_from(0);
+    }
+
+//================================================================  ===============================================================================
+
+    //     O(1)
+    Type& operator[](size_t index) noexcept
+    {
+        assert(index < size);
+        return chunks[index >> kChunkShift][index & kChunkMask];
+    }
+
+    //      O(1)
+    const Type& operator[](size_t index) const noexcept
+    {
+        assert(index < size);
+        return chunks[index >> kChunkShift][index & kChunkMask];
+    }
+
+    //    O(N)
+    ChunkedSimpleVector& operator=(const ChunkedSimpleVector& rhs)
+    {
+        if (this != &rhs)
+        {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+            {
+                *this = ChunkedSimpleVector(rhs, rhs.allocator);
+            }
+            else
+            {
+                ChunkedSimpleVector temp(rhs, allocator);
+                swap(temp);
+            }
+        }
+        return *this;
+    }
+
+    //   ,       O(N)  
+    //  ,     O(N)
+    ChunkedSimpleVector& operator=(ChunkedSimpleVector&& rhs)
+        noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+    {
+        if (this != &rhs)
+        {
+            if (AllocTraits::propagate_on_container_move_assignment::value || allocator == rhs.allocator)
+            {
+                VectorStats<Type>::released(get_capacity(), size);
+                destroy_from(0);
+                chunks = std::move(rhs.chunks);
+                if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+                {
+                    allocator = rhs.allocator;
+                }
+                size = std::exchange(rhs.size, 0);
+            }
+            else
+            {
+                ChunkedSimpleVector temp(std::move(rhs), allocator);
+                swap(temp);
+            }
+        }
+        return *this;
+    }
+
+//=====================================================================  ==========================================================================
+
+    //    O(1)
+    Iterator begin() noexcept
+    {
+        return Iterator(chunks.data(), 0);
+    }
+
+    //    O(1)
+    Iterator end() noexcept
+    {
+        return Iterator(chunks.data(), size);
+    }
+
+    //     O(1)
+    ConstIterator begin() const noexcept
+    {
+        return ConstIterator(chunks.data(), 0);
+    }
+
+    //     O(1)
+    ConstIterator end() const noexcept
+    {
+        return ConstIterator(chunks.data(), size);
+    }
+
+    // O(1)
+    ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    // O(1)
+    ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+//=====================================================================  =============================================================================
+
+//-------------------------------------------------------------    --------------------------------------------------------------------
+
+    //     O(1),      
+    void push_back(const Type& item)
+    {
+        emplace_back(item);
+    }
+
+    //     O(1)
+    void push_back(Type&& item)
+    {
+        emplace_back(std::move(item));
+    }
+
+    //       args.     ,
+    //  args      O(1)
+    template <typename... Args>
+    Type& emplace_back(Args&&... args)
+    {
+        if (size == get_capacity())
+        {
+            add_chunk();
+        }
+
+        Chunk& chunk = chunks[size >> kChunkShift];
+        Type* place = chunk.get() + (size & kChunkMask);
+        chunk.construct(place, std::forward<Args>(args)...);
+        ++size;
+
+        return *place;
+    }
+
+    //    [first, last)   O(M)
+    template <std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+    void append_range(InputIterator first, Sentinel last)
+    {
+        if constexpr (std::forward_iterator<InputIterator>)
+        {
+            reserve(size + static_cast<size_t>(std::ranges::distance(first, last)));
+        }
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    //       O(M)
+    template <std::ranges::input_range Range>
+    void append_range(Range&& range)
+    {
+        append_range(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    //   value  pos,       O(N)
+    Iterator insert(ConstIterator pos, const Type& value)
+    {
+        return emplace(pos, value);
+    }
+
+    //    pos O(N)
+    Iterator insert(ConstIterator pos, Type&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    //  count  value  pos:         O(N)
+    Iterator insert(ConstIterator pos, size_t count, const Type& value)
+    {
+        size_t index = pos - cbegin();
+        size_t old_size = size;
+
+        reserve(size + count);
+        append_filled(count, value);
+        std::rotate(begin() + index, begin() + old_size, end());
+
+        return begin() + index;
+    }
+
+    //   [first, last)  pos O(N)
+    template <std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+    Iterator insert(ConstIterator pos, InputIterator first, Sentinel last)
+    {
+        size_t index = pos - cbegin();
+        size_t old_size = size;
+
+        try
+        {
+            append_range(std::move(first), std::move(last));
+        }
+        catch (...)
+        {
+            destroy_from(old_size);
+            throw;
+        }
+        std::rotate(begin() + index, begin() + old_size, end());
+
+        return begin() + index;
+    }
+
+    //    pos O(N)
+    Iterator insert(ConstIterator pos, std::initializer_list<Type> init)
+    {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    //    args  pos O(N)
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args)
+    {
+        size_t index = pos - cbegin();
+        if (index == size)
+        {
+            emplace_back(std::forward<Args>(args)...);
+            return begin() + index;
+        }
+
+        Type value(std::forward<Args>(args)...);
+        emplace_back(std::move((*this)[size - 1]));
+        std::move_backward(begin() + index, end() - 2, end() - 1);
+        VectorStats<Type>::moved(size - index - 1);
+        (*this)[index] = std::move(value);
+
+        return begin() + index;
+    }
+
+//--------------------------------------------------------------   ------------------------------------------------------------------------
+
+    //   O(1)
+    size_t get_size() const noexcept
+    {
+        return size;
+    }
+
+    //    O(1)
+    size_t get_capacity() const noexcept
+    {
+        return chunks.get_size() * kChunkSize;
+    }
+
+    //    O(1)
+    bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    //     O(1)
+    Type& front()
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[0];
+    }
+
+    //      O(1)
+    const Type& front() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[0];
+    }
+
+    //     O(1)
+    Type& back()
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[size - 1];
+    }
+
+    //      O(1)
+    const Type& back() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[size - 1];
+    }
+
+    //        O(1)
+    Type& at(size_t index)
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return (*this)[index];
+    }
+
+    //         O(1)
+    const Type& at(size_t index) const
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return (*this)[index];
+    }
+
+//------------------------------------------------------------------------  ---------------------------------------------------------------------------
+
+    //      O(1)
+    size_t get_chunk_count() const noexcept
+    {
+        return (size + kChunkMask) >> kChunkShift;
+    }
+
+    //    index -     ,  simd- O(1)
+    SimpleVectorView<Type> chunk(size_t index) noexcept
+    {
+        assert(index < get_chunk_count());
+        return SimpleVectorView<Type>(chunks[index].get(), chunk_live(index));
+    }
+
+    //      index O(1)
+    SimpleVectorView<const Type> chunk(size_t index) const noexcept
+    {
+        assert(index < get_chunk_count());
+        return SimpleVectorView<const Type>(chunks[index].get(), chunk_live(index));
+    }
+
+//-------------------------------------------------------------------    --------------------------------------------------------------------
+
+    //  .         O(N)
+    void resize(size_t new_size)
+    {
+        if (new_size <= size)
+        {
+            destroy_from(new_size);
+            return;
+        }
+
+        reserve(new_size);
+        size_t old_size = size;
+        try
+        {
+            while (size < new_size)
+            {
+                Chunk& chunk = chunks[size >> kChunkShift];
+                size_t count = std::min(new_size - size, kChunkSize - (size & kChunkMask));
+                chunk.uninitialized_value_construct(chunk.get() + (size & kChunkMask), count);
+                size += count;
+            }
+        }
+        catch (...)
+        {
+            destroy_from(old_size);
+            throw;
+        }
+    }
+
+    //      O(N / kChunkSize)
+    void shrink_to_fit()
+    {
+        size_t used = get_chunk_count();
+        if (used < chunks.get_size())
+        {
+            VectorStats<Type>::released((chunks.get_size() - used) * kChunkSize, 0);
+            chunks.resize(used);
+            chunks.shrink_to_fit();
+        }
+    }
+
+    //  :   ,    O(new_capacity / kChunkSize)
+    void reserve(size_t new_capacity)
+    {
+        if (new_capacity > get_capacity())
+        {
+            chunks.reserve((new_capacity + kChunkMask) >> kChunkShift);
+            while (get_capacity() < new_capacity)
+            {
+                add_chunk();
+            }
+        }
+    }
+
+//------------------------------------------------------------------------    --------------------------------------------------------------
+
+    //  ,    O(N)
+    void clear() noexcept
+    {
+        destroy_from(0);
+    }
+
+    //    O(1)
+    void pop_back() noexcept
+    {
+        assert(size > 0);
+
+        --size;
+        Chunk& chunk = chunks[size >> kChunkShift];
+        Type* place = chunk.get() + (size & kChunkMask);
+        chunk.destroy(place, place + 1);
+    }
+
+    //      O(N)
+    Iterator erase(ConstIterator pos)
+    {
+        assert(pos >= cbegin() && pos < cend());
+        return erase(pos, pos + 1);
+    }
+
+    //   [first, last),     O(N)
+    Iterator erase(ConstIterator first, ConstIterator last)
+    {
+        assert(first >= cbegin() && first <= last && last <= cend());
+
+        size_t index = first - cbegin();
+        size_t tail = last - cbegin();
+
+        //  :         
+        if (index == tail)
+        {
+            return begin() + index;
+        }
+
+        std::move(begin() + tail, end(), begin() + index);
+        VectorStats<Type>::moved(size - tail);
+        destroy_from(size - (tail - index));
+
+        return begin() + index;
+    }
+
+    //     :       O(1)
+    Iterator unordered_erase(ConstIterator pos)
+    {
+        assert(pos >= cbegin() && pos < cend());
+
+        size_t index = pos - cbegin();
+        if (index != size - 1)
+        {
+            (*this)[index] = std::move((*this)[size - 1]);
+            VectorStats<Type>::moved(1);
+        }
+        pop_back();
+
+        return begin() + index;
+    }
+
+    //   ,   predicate ,    .
+    //     O(N)
+    template <typename Predicate>
+    size_t erase_if(Predicate predicate)
+    {
+        Iterator new_end = std::remove_if(begin(), end(), std::move(predicate));
+        size_t removed = end() - new_end;
+
+        destroy_from(size - removed);
+
+        return removed;
+    }
+
+//---------------------------------------------------------------------   ----------------------------------------------------------------------
+
+    //   O(1)
+    Allocator get_allocator() const noexcept
+    {
+        return allocator;
+    }
+
+    //   O(1).  ,     ,    
+    void swap(ChunkedSimpleVector& other) noexcept
+    {
+        chunks.swap(other.chunks);
+        if constexpr (AllocTraits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(allocator, other.allocator);
+        }
+        else
+        {
+            assert(allocator == other.allocator);
+        }
+        std::swap(size, other.size);
+    }
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------------
+
+private:
+
+    SimpleVector<Chunk, ChunkAllocator> chunks;
+    Allocator allocator;
+    size_t size = 0;
+
+    //     .       O(1)  
+    void add_chunk()
+    {
+        chunks.emplace_back(kChunkSize, allocator);
+    }
+
+    //      index O(1)
+    size_t chunk_live(size_t index) const noexcept
+    {
+        return std::min(kChunkSize, size - (index << kChunkShift));
+    }
+
+    //  count  value  ,   .
+    //      O(count)
+    void append_filled(size_t count, const Type& value)
+    {
+        assert(size + count <= get_capacity());
+
+        size_t old_size = size;
+        size_t new_size = size + count;
+        try
+        {
+            while (size < new_size)
+            {
+                Chunk& chunk = chunks[size >> kChunkShift];
+                size_t filled = std::min(new_size - size, kChunkSize - (size & kChunkMask));
+                chunk.uninitialized_fill(chunk.get() + (size & kChunkMask), filled, value);
+                size += filled;
+            }
+        }
+        catch (...)
+        {
+            destroy_from(old_size);
+            throw;
+        }
+    }
+
+    //   [new_size, size)   ,    O(size - new_size)
+    void destroy_from(size_t new_size) noexcept
+    {
+        while (size > new_size)
+        {
+            size_t first = std::max(new_size, (size - 1) & ~kChunkMask);
+            Chunk& chunk = chunks[first >> kChunkShift];
+            chunk.destroy(chunk.get() + (first & kChunkMask), chunk.get() + (first & kChunkMask) + (size - first));
+            size = first;
+        }
+    }
+
+public:
+
+    //   :     .  -    O(1)
+    template <bool IsConst>
+    class ChunkedIterator
+    {
+        using ChunkPointer = std::conditional_t<IsConst, const Chunk*, Chunk*>;
+
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const Type*, Type*>;
+        using reference = std::conditional_t<IsConst, const Type&, Type&>;
+
+        ChunkedIterator() noexcept = default;
+
+        ChunkedIterator(ChunkPointer table, size_t index) noexcept : table(table), index(index){}
+
+        //    
+        template <bool OtherConst>
+            requires (IsConst && !OtherConst)
+        ChunkedIterator(const ChunkedIterator<OtherConst>& other) noexcept : table(other.table), index(other.index){}
+
+        reference operator*() const noexcept
+        {
+            return table[index >> kChunkShift].get()[index & kChunkMask];
+        }
+
+        pointer operator->() const noexcept
+        {
+            return &**this;
+        }
+
+        reference operator[](difference_type offset) const noexcept
+        {
+            return *(*this + offset);
+        }
+
+        ChunkedIterator& operator++() noexcept
+        {
+            ++index;
+            return *this;
+        }
+
+        ChunkedIterator operator++(int) noexcept
+        {
+            ChunkedIterator previous = *this;
+            ++index;
+            return previous;
+        }
+
+        ChunkedIterator& operator--() noexcept
+        {
+            --index;
+            return *this;
+        }
+
+        ChunkedIterator operator--(int) noexcept
+        {
+            ChunkedIterator previous = *this;
+            --index;
+            return previous;
+        }
+
+        ChunkedIterator& operator+=(difference_type offset) noexcept
+        {
+            index += offset;
+            return *this;
+        }
+
+        ChunkedIterator& operator-=(difference_type offset) noexcept
+        {
+            index -= offset;
+            return *this;
+        }
+
+        friend ChunkedIterator operator+(ChunkedIterator it, difference_type offset) noexcept
+        {
+            return it += offset;
+        }
+
+        friend ChunkedIterator operator+(difference_type offset, ChunkedIterator it) noexcept
+        {
+            return it += offset;
+        }
+
+        friend ChunkedIterator operator-(ChunkedIterator it, difference_type offset) noexcept
+        {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const ChunkedIterator& lhs, const ChunkedIterator& rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.index - rhs.index);
+        }
+
+        friend bool operator==(const ChunkedIterator& lhs, const ChunkedIterator& rhs) noexcept
+        {
+            return lhs.index == rhs.index;
+        }
+
+        friend std::strong_ordering operator<=>(const ChunkedIterator& lhs, const ChunkedIterator& rhs) noexcept
+        {
+            return lhs.index <=> rhs.index;
+        }
+
+    private:
+
+        template <bool>
+        friend class ChunkedIterator;
+
+        ChunkPointer table = nullptr;
+        size_t index = 0;
+    };
+};
+
+//=================================================    =========================================================
+
+template <typename Type, typename Allocator, size_t ChunkBytes>
+inline bool operator==(const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& lhs, const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& rhs)
+{
+    if (lhs.get_size() != rhs.get_size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.get_chunk_count(); ++i)
+    {
+        if (lhs.chunk(i) != rhs.chunk(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Type, typename Allocator, size_t ChunkBytes>
+inline bool operator!=(const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& lhs, const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename Type, typename Allocator, size_t ChunkBytes>
+inline bool operator<(const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& lhs, const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, typename Allocator, size_t ChunkBytes>
+inline bool operator<=(const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& lhs, const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename Type, typename Allocator, size_t ChunkBytes>
+inline bool operator>(const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& lhs, const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename Type, typename Allocator, size_t ChunkBytes>
+inline bool operator>=(const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& lhs, const ChunkedSimpleVector<Type, Allocator, ChunkBytes>& rhs)
+{
+    return !(lhs < rhs);
+}
@@ -0,0 +1,332 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+//       .     
+//  32, 64, 128, ...,          
+// .    fetch_add.    compare_exchange  ,
+//      ,    ,     
+//    .        
+template <typename Type, typename Allocator = std::allocator<Type>>
+class ConcurrentSimpleVector
+{
+public:
+
+    //   ,     
+    explicit ConcurrentSimpleVector(const Allocator& alloc = Allocator()) : allocator(alloc), slot_allocator(alloc)
+    {
+        for (std::atomic<Slot*>& segment : segments)
+        {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentSimpleVector(const ConcurrentSimpleVector&) = delete;
+    ConcurrentSimpleVector& operator=(const ConcurrentSimpleVector&) = delete;
+
+    //      ,         O(N)
+    ~ConcurrentSimpleVector()
+    {
+        clear();
+    }
+
+//=====================================================================  =========================================================================
+
+    //       ,    O(1),   
+    //    L  O(L)
+    size_t push_back(const Type& value)
+    {
+        return emplace_back(value);
+    }
+
+    //        ,    O(1),   O(L)
+    size_t push_back(Type&& value)
+    {
+        return emplace_back(std::move(value));
+    }
+
+    //       ,   .   
+    // ,       freeze O(1),   O(L)
+    template <typename... Args>
+    size_t emplace_back(Args&&... args)
+    {
+        size_t index = reserved.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slot_at(index);
+
+        try
+        {
+            ElementTraits::construct(allocator, slot.get(), std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            slot.state.store(kFailed, std::memory_order_release);
+            throw;
+        }
+        slot.state.store(kReady, std::memory_order_release);
+
+        return index;
+    }
+
+//=======================================================================  ===========================================================================
+
+    //   ,      O(1)
+    size_t get_size() const noexcept
+    {
+        return reserved.load(std::memory_order_acquire);
+    }
+
+    //    index      O(1)
+    bool is_published(size_t index) const noexcept
+    {
+        const Slot* slot = find_slot(index);
+        return slot && slot->state.load(std::memory_order_acquire) == kReady;
+    }
+
+    //      nullptr,      O(1)
+    const Type* try_get(size_t index) const noexcept
+    {
+        const Slot* slot = find_slot(index);
+        if (!slot || slot->state.load(std::memory_order_acquire) != kReady)
+        {
+            return nullptr;
+        }
+        return slot->get();
+    }
+
+    Type* try_get(size_t index) noexcept
+    {
+        return const_cast<Type*>(std::as_const(*this).try_get(index));
+    }
+
+    //     O(1)
+    const Type& operator[](size_t index) const noexcept
+    {
+        const Type* value = try_get(index);
+        assert(value);
+        return *value;
+    }
+
+    Type& operator[](size_t index) noexcept
+    {
+        Type* value = try_get(index);
+        assert(value);
+        return *value;
+    }
+
+    //       O(1)
+    const Type& at(size_t index) const
+    {
+        const Type* value = try_get(index);
+        if (!value)
+        {
+            throw std::out_of_range("Element is not published");
+        }
+        return *value;
+    }
+
+//================================================================   ===================================================================
+
+    //         SimpleVector    .
+    // ,     O(N)
+    SimpleVector<Type, Allocator> freeze()
+    {
+        size_t count = std::min(get_size(), kMaxSize);
+
+        SimpleVector<Type, Allocator> result(allocator);
+        result.reserve(count);
+        for (size_t index = 0; index < count; ++index)
+        {
+            if (Type* value = try_get(index))
+            {
+                result.push_back(std::move(*value));
+            }
+        }
+
+        clear();
+        return result;
+    }
+
+    //     ,         O(N)
+    void clear() noexcept
+    {
+        size_t count = std::min(get_size(), kMaxSize);
+
+        for (size_t segment = 0; segment < kSegmentCount; ++segment)
+        {
+            Slot* slots = segments[segment].load(std::memory_order_acquire);
+            if (!slots)
+            {
+                continue;
+            }
+
+            size_t first = segment_start(segment);
+            size_t length = segment_length(segment);
+            for (size_t offset = 0; offset < length && first + offset < count; ++offset)
+            {
+                if (slots[offset].state.load(std::memory_order_relaxed) == kReady)
+                {
+                    ElementTraits::destroy(allocator, slots[offset].get());
+                }
+            }
+            release_segment(slots, length);
+            segments[segment].store(nullptr, std::memory_order_relaxed);
+        }
+        reserved.store(0, std::memory_order_release);
+    }
+
+private:
+
+    static constexpr uint8_t kEmpty = 0;
+    static constexpr uint8_t kReady = 1;
+    static constexpr uint8_t kFailed = 2;
+
+    //  :       
+    struct Slot
+    {
+        std::atomic<uint8_t> state{ kEmpty };
+        alignas(Type) unsigned char storage[sizeof(Type)];
+
+        Type* get() noexcept
+        {
+            return reinterpret_cast<Type*>(storage);
+        }
+
+        const Type* get() const noexcept
+        {
+            return reinterpret_cast<const Type*>(storage);
+        }
+    };
+
+    using ElementTraits = std::allocator_traits<Allocator>;
+    using SlotAllocator = typename ElementTraits::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+    static constexpr size_t kBaseBits = 5;
+    static constexpr size_t kSegmentCount = 64 - kBaseBits;
+    static constexpr size_t kMaxSize = ((size_t(1) << kSegmentCount) - 1) << kBaseBits;
+
+    [[no_unique_address]] Allocator allocator;
+    [[no_unique_address]] SlotAllocator slot_allocator;
+    std::atomic<Slot*> segments[kSegmentCount];
+    std::atomic<size_t> reserved{ 0 };
+
+    //  ,     index O(1)
+    static size_t segment_of(size_t index) noexcept
+    {
+        size_t value = (index >> kBaseBits) + 1;
+        size_t segment = 0;
+        while (value >>= 1)
+        {
+            ++segment;
+        }
+        return segment;
+    }
+
+    //     O(1)
+    static size_t segment_start(size_t segment) noexcept
+    {
+        return ((size_t(1) << segment) - 1) << kBaseBits;
+    }
+
+    //     O(1)
+    static size_t segment_length(size_t segment) noexcept
+    {
+        return size_t(1) << (segment + kBaseBits);
+    }
+
+    //   index  nullptr,       O(1)
+    const Slot* find_slot(size_t index) const noexcept
+    {
+        if (index >= kMaxSize)
+        {
+            return nullptr;
+        }
+        size_t segment = segment_of(index);
+        const Slot* slots = segments[segment].load(std::memory_order_acquire);
+        return slots && slots != installing() ? slots + (index - segment_start(segment)) : nullptr;
+    }
+
+    //  ,      .     
+    static Slot* installing() noexcept
+    {
+        return reinterpret_cast<Slot*>(std::uintptr_t(1));
+    }
+
+    //   index,    .    , 
+    //     installing(),   .    ,
+    //          O(1),   O(L)
+    Slot& slot_at(size_t index)
+    {
+        if (index >= kMaxSize)
+        {
+            throw std::length_error("ConcurrentSimpleVector is full");
+        }
+
+        size_t segment = segment_of(index);
+        std::atomic<Slot*>& published = segments[segment];
+
+        for (;;)
+        {
+            Slot* slots = published.load(std::memory_order_acquire);
+            if (slots == installing())
+            {
+                published.wait(slots, std::memory_order_acquire);
+            }
+            else if (slots)
+            {
+                return slots[index - segment_start(segment)];
+            }
+            else if (published.compare_exchange_strong(slots, installing(), std::memory_order_acquire, std::memory_order_acquire))
+            {
+                install_segment(segment);
+            }
+        }
+    }
+
+    //     ,   .      
+    //  O(L)
+    void install_segment(size_t segment)
+    {
+        size_t length = segment_length(segment);
+        Slot* fresh = nullptr;
+
+        try
+        {
+            fresh = SlotTraits::allocate(slot_allocator, length);
+            for (size_t i = 0; i < length; ++i)
+            {
+                SlotTraits::construct(slot_allocator, fresh + i);
+            }
+        }
+        catch (...)
+        {
+            if (fresh)
+            {
+                SlotTraits::deallocate(slot_allocator, fresh, length);
+            }
+            segments[segment].store(nullptr, std::memory_order_release);
+            segments[segment].notify_all();
+            throw;
+        }
+
+        segments[segment].store(fresh, std::memory_order_release);
+        segments[segment].notify_all();
+    }
+
+    //        O(L)
+    void release_segment(Slot* slots, size_t length) noexcept
+    {
+        for (size_t i = 0; i < length; ++i)
+        {
+            SlotTraits::destroy(slot_allocator, slots + i);
+        }
+        SlotTraits::deallocate(slot_allocator, slots, length);
+    }
+};
@@ -0,0 +1,622 @@
+#pragma once
+
+#include "simple_vector.h"
+#include "simple_vector_view.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+//     :    SimpleVector   ,   O(1).
+//       ( operator[], begin, push_back, insert, erase,
+// resize  ..)   .  ,  ,      
+// ;         ,   SimpleVector.
+//   ,         :   
+// ,          
+template <typename Type, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DoublingGrowth>
+class CowSimpleVector
+{
+public:
+
+    using Vector = SimpleVector<Type, Allocator, GrowthPolicy>;
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+    using allocator_type = Allocator;
+
+//=====================================================================    ==========================================================
+
+    CowSimpleVector() noexcept = default;
+
+    //      ,      
+    explicit CowSimpleVector(const Allocator& alloc) noexcept : allocator(alloc){}
+
+    //      
+    explicit CowSimpleVector(size_t size, const Allocator& alloc = Allocator()) : CowSimpleVector(Vector(size, alloc)){}
+
+    //     
+    CowSimpleVector(size_t size, const Type& value, const Allocator& alloc = Allocator()) : CowSimpleVector(Vector(size, value, alloc)){}
+
+    //     {}
+    CowSimpleVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator()) : CowSimpleVector(Vector(init, alloc)){}
+
+    //   SimpleVector    O(1)
+    explicit CowSimpleVector(Vector&& items) : allocator(items.get_allocator())
+    {
+        shared = create(std::move(items));
+    }
+
+    //      other O(1).   other    ,   O(N)
+    CowSimpleVector(const CowSimpleVector& other) : allocator(other.allocator)
+    {
+        if (other.shared && other.shared->unshareable)
+        {
+            shared = create(Vector(other.shared->items));
+        }
+        else if (other.shared)
+        {
+            shared = other.shared;
+            shared->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    //  
+    CowSimpleVector(CowSimpleVector&& other) noexcept
+        : allocator(other.allocator), shared(std::exchange(other.shared, nullptr)){}
+
+    //  ,     O(N)   ,  O(1)
+    ~CowSimpleVector()
+    {
+        release();
+    }
+
+//================================================================  ===============================================================================
+
+    //         O(1)
+    const Type& operator[](size_t index) const noexcept
+    {
+        assert(index < get_size());
+        return shared->items[index];
+    }
+
+    //    ,    O(N)   ,  O(1)
+    Type& operator[](size_t index)
+    {
+        assert(index < get_size());
+        return writable()[index];
+    }
+
+    //      rhs O(1),        .
+    // ,      rhs   ,       O(N)
+    CowSimpleVector& operator=(const CowSimpleVector& rhs)
+    {
+        if (this == &rhs)
+        {
+            return *this;
+        }
+
+        if (AllocTraits::propagate_on_container_copy_assignment::value || allocator == rhs.allocator)
+        {
+            CowSimpleVector temp(rhs);
+            release();
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+            {
+                allocator = rhs.allocator;
+            }
+            shared = std::exchange(temp.shared, nullptr);
+        }
+        else
+        {
+            Shared* created = rhs.shared ? create(Vector(rhs.shared->items, allocator)) : nullptr;
+            release();
+            shared = created;
+        }
+        return *this;
+    }
+
+    //    O(1),        .
+    //       :      ,  
+    //     O(N)
+    CowSimpleVector& operator=(CowSimpleVector&& rhs)
+        noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+    {
+        if (this == &rhs)
+        {
+            return *this;
+        }
+
+        if (AllocTraits::propagate_on_container_move_assignment::value || allocator == rhs.allocator)
+        {
+            release();
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+            {
+                allocator = rhs.allocator;
+            }
+            shared = std::exchange(rhs.shared, nullptr);
+        }
+        else
+        {
+            Shared* created = nullptr;
+            if (rhs.is_shared())
+            {
+                created = create(Vector(rhs.shared->items, allocator));
+            }
+            else if (rhs.shared)
+            {
+                created = create(Vector(std::move(rhs.shared->items), allocator));
+            }
+            release();
+            shared = created;
+            rhs.release();
+        }
+        return *this;
+    }
+
+//=====================================================================  ==========================================================================
+
+    //     ,    O(N)   ,  O(1)
+    Iterator begin()
+    {
+        return shared ? writable().begin() : nullptr;
+    }
+
+    //      O(N)   ,  O(1)
+    Iterator end()
+    {
+        return shared ? writable().end() : nullptr;
+    }
+
+    //     O(1)
+    ConstIterator begin() const noexcept
+    {
+        return shared ? shared->items.begin() : nullptr;
+    }
+
+    //     O(1)
+    ConstIterator end() const noexcept
+    {
+        return shared ? shared->items.end() : nullptr;
+    }
+
+    // O(1)
+    ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    // O(1)
+    ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+//=====================================================================  =============================================================================
+
+//-------------------------------------------------------------    --------------------------------------------------------------------
+
+    //     ,      O(N)
+    void push_back(const Type& item)
+    {
+        append(item);
+    }
+
+    //     ,      O(N)
+    void push_back(Type&& item)
+    {
+        append(std::move(item));
+    }
+
+    //    ,     O(N)
+    template <typename... Args>
+    Type& emplace_back(Args&&... args)
+    {
+        Type& item = append(std::forward<Args>(args)...);
+        shared->unshareable = true;
+        return item;
+    }
+
+    //       O(N)
+    Iterator insert(ConstIterator pos, const Type& value)
+    {
+        return emplace(pos, value);
+    }
+
+    //       O(N)
+    Iterator insert(ConstIterator pos, Type&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    //  count  value    O(N)
+    Iterator insert(ConstIterator pos, size_t count, const Type& value)
+    {
+        size_t index = pos - begin_const();
+
+        if (!is_shared())
+        {
+            Vector& items = writable();
+            return items.insert(items.begin() + index, count, value);
+        }
+
+        // value     ,    
+        Type temp(value);
+        Vector& items = writable(get_size() + count);
+        return items.insert(items.begin() + index, count, temp);
+    }
+
+    //      O(N)
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args)
+    {
+        assert(pos >= cbegin() && pos <= cend());
+
+        size_t index = pos - begin_const();
+
+        if (!is_shared())
+        {
+            Vector& items = writable();
+            return items.emplace(items.begin() + index, std::forward<Args>(args)...);
+        }
+
+        Type temp(std::forward<Args>(args)...);
+        Vector& items = writable(get_size() + 1);
+        return items.emplace(items.begin() + index, std::move(temp));
+    }
+
+//--------------------------------------------------------------   ------------------------------------------------------------------------
+
+    //   O(1)
+    size_t get_size() const noexcept
+    {
+        return shared ? shared->items.get_size() : 0;
+    }
+
+    //    O(1)
+    size_t get_capacity() const noexcept
+    {
+        return shared ? shared->items.get_capacity() : 0;
+    }
+
+    //    O(1)
+    bool is_empty() const noexcept
+    {
+        return get_size() == 0;
+    }
+
+    //           O(1)
+    bool is_shared() const noexcept
+    {
+        return shared && shared->references.load(std::memory_order_acquire) > 1;
+    }
+
+    //  ,   O(1)
+    size_t use_count() const noexcept
+    {
+        return shared ? shared->references.load(std::memory_order_acquire) : 0;
+    }
+
+    //      O(1)
+    const Type& front() const
+    {
+        if (is_empty())
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return shared->items[0];
+    }
+
+    //      O(1)
+    const Type& back() const
+    {
+        if (is_empty())
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return shared->items[get_size() - 1];
+    }
+
+    //       O(1)
+    const Type& at(size_t index) const
+    {
+        if (index >= get_size())
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return shared->items[index];
+    }
+
+    //        O(N)   ,  O(1)
+    Type& at(size_t index)
+    {
+        if (index >= get_size())
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return writable()[index];
+    }
+
+    //      O(1)
+    const Type* data() const noexcept
+    {
+        return begin();
+    }
+
+    //       O(N)   ,  O(1)
+    Type* data()
+    {
+        return begin();
+    }
+
+    //     ,    O(1)
+    SimpleVectorView<const Type> view() const noexcept
+    {
+        return SimpleVectorView<const Type>(begin(), get_size());
+    }
+
+//-------------------------------------------------------------------    --------------------------------------------------------------------
+
+    //   O(N)
+    void resize(size_t new_size)
+    {
+        if (new_size == get_size())
+        {
+            return;
+        }
+        if (new_size < get_size() && is_shared())
+        {
+            //    
+            replace(new_size, new_size, get_size() - new_size);
+            return;
+        }
+        detach(new_size).resize(new_size);
+    }
+
+    //   O(N)
+    void reserve(size_t new_capacity)
+    {
+        if (new_capacity > get_capacity())
+        {
+            detach(new_capacity).reserve(new_capacity);
+        }
+    }
+
+    //     O(N)
+    void shrink_to_fit()
+    {
+        if (is_shared())
+        {
+            //      ,  
+            detach();
+        }
+        else if (shared)
+        {
+            shared->items.shrink_to_fit();
+        }
+    }
+
+//------------------------------------------------------------------------    --------------------------------------------------------------
+
+    //  ,     O(1),  O(N).
+    //    ,     
+    void clear() noexcept
+    {
+        if (is_shared())
+        {
+            release();
+        }
+        else if (shared)
+        {
+            shared->items.clear();
+            shared->unshareable = false;
+        }
+    }
+
+    //    O(N)   ,  O(1)
+    void pop_back()
+    {
+        assert(!is_empty());
+
+        if (is_shared())
+        {
+            replace(get_size() - 1, get_size() - 1, 1);
+            return;
+        }
+        shared->items.pop_back();
+    }
+
+    //      O(N)
+    Iterator erase(ConstIterator pos)
+    {
+        assert(pos >= cbegin() && pos < cend());
+
+        return erase(pos, pos + 1);
+    }
+
+    //   [first, last).       O(N)
+    Iterator erase(ConstIterator first, ConstIterator last)
+    {
+        assert(first >= cbegin() && first <= last && last <= cend());
+
+        size_t index = first - begin_const();
+        size_t count = last - first;
+
+        if (is_shared())
+        {
+            replace(get_size() - count, index, count);
+            return shared ? writable().begin() + index : nullptr;
+        }
+
+        Vector& items = writable();
+        return items.erase(items.begin() + index, items.begin() + index + count);
+    }
+
+//---------------------------------------------------------------------   ----------------------------------------------------------------------
+
+    //   O(1)
+    Allocator get_allocator() const noexcept
+    {
+        return allocator;
+    }
+
+    //   O(1).  ,     ,    
+    void swap(CowSimpleVector& other) noexcept
+    {
+        if constexpr (AllocTraits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(allocator, other.allocator);
+        }
+        else
+        {
+            assert(allocator == other.allocator);
+        }
+        std::swap(shared, other.shared);
+    }
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------------
+
+private:
+
+    //  :  ,        .
+    // unshareable    ,    
+    struct Shared
+    {
+        std::atomic<size_t> references{ 1 };
+        bool unshareable = false;
+        Vector items;
+
+        explicit Shared(Vector&& items) noexcept : items(std::move(items)){}
+    };
+
+    using AllocTraits = std::allocator_traits<Allocator>;
+    using SharedAllocator = typename AllocTraits::template rebind_alloc<Shared>;
+    using SharedTraits = std::allocator_traits<SharedAllocator>;
+
+    [[no_unique_address]] Allocator allocator;
+    Shared* shared = nullptr;
+
+    //       O(1)
+    ConstIterator begin_const() const noexcept
+    {
+        return begin();
+    }
+
+    //      items O(1)
+    Shared* create(Vector&& items)
+    {
+        SharedAllocator shared_allocator(allocator);
+        Shared* created = SharedTraits::allocate(shared_allocator, 1);
+        SharedTraits::construct(shared_allocator, created, std::move(items));
+        return created;
+    }
+
+    //   ,    . acq_rel    
+    //   O(N)   ,  O(1)
+    void release() noexcept
+    {
+        Shared* old = std::exchange(shared, nullptr);
+        if (old && old->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            SharedAllocator shared_allocator(allocator);
+            SharedTraits::destroy(shared_allocator, old);
+            SharedTraits::deallocate(shared_allocator, old, 1);
+        }
+    }
+
+    //       count    gap   
+    //   new_size.       ( ) O(N)
+    void replace(size_t new_size, size_t gap, size_t count = 0)
+    {
+        Vector copy(allocator);
+        copy.reserve(std::max(new_size, get_size() - count));
+        copy.append_range(begin_const(), begin_const() + gap);
+        copy.append_range(begin_const() + gap + count, cend());
+
+        Shared* created = copy.is_empty() && copy.get_capacity() == 0 ? nullptr : create(std::move(copy));
+        release();
+        shared = created;
+    }
+
+    //   ,      capacity_hint .
+    //     O(N)  ,  O(1)
+    Vector& detach(size_t capacity_hint = 0)
+    {
+        if (!shared)
+        {
+            shared = create(Vector(allocator));
+        }
+        else if (is_shared())
+        {
+            replace(std::max(capacity_hint, get_size()), get_size());
+            if (!shared)
+            {
+                shared = create(Vector(allocator));
+            }
+        }
+        return shared->items;
+    }
+
+    //       :       ,
+    //          O(N)  ,  O(1)
+    Vector& writable(size_t capacity_hint = 0)
+    {
+        Vector& items = detach(capacity_hint);
+        shared->unshareable = true;
+        return items;
+    }
+
+    //       .      
+    //    O(N)
+    template <typename... Args>
+    Type& append(Args&&... args)
+    {
+        if (is_shared())
+        {
+            //      ,     
+            Type temp(std::forward<Args>(args)...);
+            return detach(get_size() + 1).emplace_back(std::move(temp));
+        }
+        return detach(get_size() + 1).emplace_back(std::forward<Args>(args)...);
+    }
+};
+
+//=================================================    =========================================================
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator==(const CowSimpleVector<Type, Allocator, GrowthPolicy>& lhs, const CowSimpleVector<Type, Allocator, GrowthPolicy>& rhs)
+{
+    return lhs.view() == rhs.view();
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator!=(const CowSimpleVector<Type, Allocator, GrowthPolicy>& lhs, const CowSimpleVector<Type, Allocator, GrowthPolicy>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator<(const CowSimpleVector<Type, Allocator, GrowthPolicy>& lhs, const CowSimpleVector<Type, Allocator, GrowthPolicy>& rhs)
+{
+    return lhs.view() < rhs.view();
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator<=(const CowSimpleVector<Type, Allocator, GrowthPolicy>& lhs, const CowSimpleVector<Type, Allocator, GrowthPolicy>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator>(const CowSimpleVector<Type, Allocator, GrowthPolicy>& lhs, const CowSimpleVector<Type, Allocator, GrowthPolicy>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator>=(const CowSimpleVector<Type, Allocator, GrowthPolicy>& lhs, const CowSimpleVector<Type, Allocator, GrowthPolicy>& rhs)
+{
+    return !(lhs < rhs);
+}
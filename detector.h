@@ -1,29 +1,315 @@
 #pragma once
 
-#define _CRTDBG_MAP_ALLOC
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
-#include <crtdbg.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 
-#ifdef _DEBUG
-#define DEBUG_NEW new(_NORMAL_BLOCK, __FILE__, __LINE__)
-#define new DEBUG_NEW
+#if defined(_MSC_VER)
+#define _CRTDBG_MAP_ALLOC
+#include <crtdbg.h>
 #endif
 
+//=================================================================    =================================================================
+
+//   
+struct AllocationRecord
+{
+    size_t bytes = 0;
+    const char* tag = nullptr;
+    size_t sequence = 0;    //     
+};
+
+//    TrackingAllocator.      ,  
+//      ,     
+class AllocationTracker
+{
+public:
+
+    //   
+    static AllocationTracker& instance()
+    {
+        static AllocationTracker tracker;
+        return tracker;
+    }
+
+    // ,      ALLOCATION_TAG,  nullptr O(1)
+    static const char*& current_tag() noexcept
+    {
+        thread_local const char* tag = nullptr;
+        return tag;
+    }
+
+    //   ptr  bytes   tag O(1)
+    void on_allocate(void* ptr, size_t bytes, const char* tag)
+    {
+        size_t sequence = total_allocations.fetch_add(1, std::memory_order_relaxed);
+
+        Shard& shard = shard_for(ptr);
+        {
+            std::lock_guard lock(shard.mutex);
+            shard.live.emplace(ptr, AllocationRecord{ bytes, tag, sequence });
+        }
+
+        size_t live = live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t peak = peak_bytes.load(std::memory_order_relaxed);
+        while (peak < live && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    //   ptr  ,      O(1)
+    void on_deallocate(void* ptr) noexcept
+    {
+        Shard& shard = shard_for(ptr);
+        size_t bytes = 0;
+        {
+            std::lock_guard lock(shard.mutex);
+            auto it = shard.live.find(ptr);
+            if (it == shard.live.end())
+            {
+                unknown_deallocations.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            bytes = it->second.bytes;
+            shard.live.erase(it);
+        }
+        live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    //         since O(N)
+    size_t get_live_count(size_t since = 0) const
+    {
+        size_t count = 0;
+        for (const Shard& shard : shards)
+        {
+            std::lock_guard lock(shard.mutex);
+            if (since == 0)
+            {
+                count += shard.live.size();
+                continue;
+            }
+            for (const auto& [ptr, record] : shard.live)
+            {
+                count += record.sequence >= since;
+            }
+        }
+        return count;
+    }
+
+    size_t get_live_bytes() const noexcept
+    {
+        return live_bytes.load(std::memory_order_relaxed);
+    }
+
+    size_t get_peak_bytes() const noexcept
+    {
+        return peak_bytes.load(std::memory_order_relaxed);
+    }
+
+    size_t get_total_allocations() const noexcept
+    {
+        return total_allocations.load(std::memory_order_relaxed);
+    }
+
+    size_t get_unknown_deallocations() const noexcept
+    {
+        return unknown_deallocations.load(std::memory_order_relaxed);
+    }
+
+    //         O(1)
+    void reset_peak() noexcept
+    {
+        peak_bytes.store(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    //         since,   ,
+    //    .     get_total_allocations() O(N)
+    size_t report_leaks(std::ostream& out, size_t since = 0) const
+    {
+        std::map<std::string, std::pair<size_t, size_t>> by_tag;
+        size_t count = 0;
+        size_t leaked_bytes = 0;
+        for (const Shard& shard : shards)
+        {
+            std::lock_guard lock(shard.mutex);
+            for (const auto& [ptr, record] : shard.live)
+            {
+                if (record.sequence < since)
+                {
+                    continue;
+                }
+                auto& [blocks, bytes] = by_tag[record.tag ? record.tag : "untagged"];
+                ++blocks;
+                bytes += record.bytes;
+                ++count;
+                leaked_bytes += record.bytes;
+            }
+        }
+
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        out << "Detected memory leaks: " << count << " blocks, " << leaked_bytes << " bytes, peak "
+            << get_peak_bytes() << " bytes" << std::endl;
+        for (const auto& [tag, totals] : by_tag)
+        {
+            out << "  " << tag << ": " << totals.first << " blocks, " << totals.second << " bytes" << std::endl;
+        }
+        return count;
+    }
+
+private:
+
+    static constexpr size_t kShardCount = 64;
+
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        std::unordered_map<void*, AllocationRecord> live;
+    };
+
+    std::array<Shard, kShardCount> shards;
+    std::atomic<size_t> live_bytes{ 0 };
+    std::atomic<size_t> peak_bytes{ 0 };
+    std::atomic<size_t> total_allocations{ 0 };
+    std::atomic<size_t> unknown_deallocations{ 0 };
+
+    AllocationTracker() = default;
+
+    //   :   ,      O(1)
+    Shard& shard_for(void* ptr) noexcept
+    {
+        uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+        return shards[(address >> 4 ^ address >> 12) % kShardCount];
+    }
+};
+
+// ,    TrackingAllocator      tag.  
+class AllocationTag
+{
+public:
+
+    explicit AllocationTag(const char* tag) noexcept : previous(std::exchange(AllocationTracker::current_tag(), tag)){}
+
+    AllocationTag(const AllocationTag&) = delete;
+    AllocationTag& operator=(const AllocationTag&) = delete;
+
+    ~AllocationTag()
+    {
+        AllocationTracker::current_tag() = previous;
+    }
+
+private:
+
+    const char* previous;
+};
+
+#define ALLOCATION_TAG_CONCAT_INTERNAL(X, Y) X##Y
+#define ALLOCATION_TAG_CONCAT(X, Y) ALLOCATION_TAG_CONCAT_INTERNAL(X, Y)
+#define ALLOCATION_TAG(tag) AllocationTag ALLOCATION_TAG_CONCAT(allocationTag, __LINE__)(tag)
+
+//   std::allocator,     AllocationTracker.
+//     ,     ALLOCATION_TAG
+template <typename Type>
+class TrackingAllocator
+{
+public:
+
+    using value_type = Type;
+    using is_always_equal = std::true_type;
+
+    TrackingAllocator() noexcept = default;
+
+    explicit TrackingAllocator(const char* tag) noexcept : tag(tag){}
+
+    template <typename Other>
+    TrackingAllocator(const TrackingAllocator<Other>& other) noexcept : tag(other.get_tag()){}
+
+    //    count  O(1)
+    Type* allocate(size_t count)
+    {
+        Type* ptr = std::allocator<Type>().allocate(count);
+        try
+        {
+            AllocationTracker::instance().on_allocate(ptr, count * sizeof(Type), tag ? tag : AllocationTracker::current_tag());
+        }
+        catch (...)
+        {
+            std::allocator<Type>().deallocate(ptr, count);
+            throw;
+        }
+        return ptr;
+    }
+
+    //    count  O(1)
+    void deallocate(Type* ptr, size_t count) noexcept
+    {
+        AllocationTracker::instance().on_deallocate(ptr);
+        std::allocator<Type>().deallocate(ptr, count);
+    }
+
+    const char* get_tag() const noexcept
+    {
+        return tag;
+    }
+
+    template <typename Other>
+    bool operator==(const TrackingAllocator<Other>&) const noexcept
+    {
+        return true;
+    }
+
+private:
+
+    const char* tag = nullptr;
+};
+
+//=================================================================   =======================================================================
+
+//    :  TrackingAllocator,      
+//  ,   stderr.  MSVC      CRT
 class MemoryLeakDetector
 {
 public:
     MemoryLeakDetector()
     {
+#if defined(_MSC_VER)
         //     
         _CrtSetReportMode(_CRT_WARN, _CRTDBG_MODE_FILE);
 
         //     
         _CrtSetReportFile(_CRT_WARN, _CRTDBG_FILE_STDERR);
+#endif
     }
 
     ~MemoryLeakDetector()
     {
-        //     
+        //       ,    
+        AllocationTracker::instance().report_leaks(std::cerr, first_sequence);
+#if defined(_MSC_VER)
         _CrtDumpMemoryLeaks();
+#endif
     }
-};
\ No newline at end of file
+
+private:
+
+    //        
+    size_t first_sequence = AllocationTracker::instance().get_total_allocations();
+};
+
+//  new     ,  ,     
+#if defined(_MSC_VER) && defined(_DEBUG)
+#define DEBUG_NEW new(_NORMAL_BLOCK, __FILE__, __LINE__)
+#define new DEBUG_NEW
+#endif
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+//        :
+// static size_t next_capacity(size_t capacity, size_t required, size_t element_size),
+//    required. element_size  ,     
+
+//     numerator / denominator,    O(1)
+template <size_t Numerator, size_t Denominator>
+inline size_t scale_capacity(size_t capacity, size_t required) noexcept
+{
+    static_assert(Numerator > Denominator, "Growth factor must be greater than one");
+
+    size_t max_capacity = std::numeric_limits<size_t>::max();
+    if (capacity > max_capacity / Numerator)
+    {
+        return std::max(required, max_capacity / Denominator);
+    }
+    return std::max(required, capacity * Numerator / Denominator);
+}
+
+//   2 :  ,     
+struct DoublingGrowth
+{
+    static size_t next_capacity(size_t capacity, size_t required, size_t) noexcept
+    {
+        return scale_capacity<2, 1>(capacity, required);
+    }
+};
+
+//   1.5 :       
+struct OneAndHalfGrowth
+{
+    static size_t next_capacity(size_t capacity, size_t required, size_t) noexcept
+    {
+        return scale_capacity<3, 2>(capacity, required);
+    }
+};
+
+//     (~1.618)
+struct GoldenRatioGrowth
+{
+    static size_t next_capacity(size_t capacity, size_t required, size_t) noexcept
+    {
+        return scale_capacity<1618, 1000>(capacity, required);
+    }
+};
+
+//     :   , O(N) 
+template <size_t Step>
+struct FixedStepGrowth
+{
+    static_assert(Step > 0, "Growth step must be positive");
+
+    static size_t next_capacity(size_t capacity, size_t required, size_t) noexcept
+    {
+        if (capacity > std::numeric_limits<size_t>::max() - Step)
+        {
+            return required;
+        }
+        return std::max(required, capacity + Step);
+    }
+};
+
+//   ,   Base,    Bucket 
+// (,   ),      
+template <size_t Bucket = 4096, typename Base = DoublingGrowth>
+struct RoundUpGrowth
+{
+    static_assert(Bucket > 0 && (Bucket & (Bucket - 1)) == 0, "Bucket must be a power of two");
+
+    static size_t next_capacity(size_t capacity, size_t required, size_t element_size) noexcept
+    {
+        size_t base = Base::next_capacity(capacity, required, element_size);
+        if (base > (std::numeric_limits<size_t>::max() - Bucket) / element_size)
+        {
+            return base;
+        }
+
+        size_t bytes = (base * element_size + Bucket - 1) & ~(Bucket - 1);
+        return std::max(base, bytes / element_size);
+    }
+};
@@ -1,35 +1,420 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 using namespace std;
 
 #define PROFILE_CONCAT_INTERNAL(X, Y) X##Y
 #define PROFILE_CONCAT(X, Y) PROFILE_CONCAT_INTERNAL(X, Y)
 #define UNIQUE_VAR_NAME_PROFILE PROFILE_CONCAT(profileGuard, __LINE__)
-#define LOG_DURATION(x) LogDuration UNIQUE_VAR_NAME_PROFILE(x)
 
-class LogDuration
+//           x.     
+//   ,  x -   :   ""     
+#define LOG_DURATION(x) ProfileScope UNIQUE_VAR_NAME_PROFILE([]() { static const size_t site = Profiler::instance().site_index("" x); return site; }())
+
+//   ,     :        O(S)
+#define LOG_DURATION_DYNAMIC(x) ProfileScope UNIQUE_VAR_NAME_PROFILE(std::string(x))
+
+//======================================================================  ======================================================================
+
+// -    :      2^kSubBits
+//  ,      1/2^kSubBits.   ,  
+//  :  ,    
+class ProfileHistogram
 {
 public:
 
-    using Clock = chrono::steady_clock;
+    static constexpr size_t kSubBits = 5;
+    static constexpr size_t kSubBuckets = size_t(1) << kSubBits;
+    static constexpr size_t kBuckets = (64 - kSubBits + 1) * kSubBuckets;
+
+    //  ,   - O(1)
+    void record(uint64_t nanoseconds) noexcept
+    {
+        increment(buckets[bucket_index(nanoseconds)], 1);
+        increment(count, 1);
+        increment(total, nanoseconds);
+        if (nanoseconds < min.load(std::memory_order_relaxed))
+        {
+            min.store(nanoseconds, std::memory_order_relaxed);
+        }
+        if (nanoseconds > max.load(std::memory_order_relaxed))
+        {
+            max.store(nanoseconds, std::memory_order_relaxed);
+        }
+    }
+
+    //     O(1)
+    static size_t bucket_index(uint64_t value) noexcept
+    {
+        if (value < kSubBuckets)
+        {
+            return static_cast<size_t>(value);
+        }
+        size_t exponent = highest_bit(value);
+        size_t sub = static_cast<size_t>(value >> (exponent - kSubBits)) & (kSubBuckets - 1);
+        return (exponent - kSubBits + 1) * kSubBuckets + sub;
+    }
+
+    //  ,    index O(1)
+    static uint64_t bucket_lower(size_t index) noexcept
+    {
+        if (index < kSubBuckets)
+        {
+            return index;
+        }
+        size_t exponent = index / kSubBuckets + kSubBits - 1;
+        return (uint64_t(1) << exponent) | (uint64_t(index % kSubBuckets) << (exponent - kSubBits));
+    }
 
-    LogDuration(const std::string& id) : id_(id) {}
+    //   index O(1)
+    static uint64_t bucket_width(size_t index) noexcept
+    {
+        return index < 2 * kSubBuckets ? 1 : uint64_t(1) << (index / kSubBuckets - 1);
+    }
 
-    ~LogDuration()
+    //    accumulator,    O(B)
+    void merge_into(std::vector<uint64_t>& accumulator, uint64_t& merged_count, uint64_t& merged_total,
+        uint64_t& merged_min, uint64_t& merged_max) const noexcept
     {
-        using namespace chrono;
-        using namespace literals;
+        for (size_t i = 0; i < kBuckets; ++i)
+        {
+            accumulator[i] += buckets[i].load(std::memory_order_relaxed);
+        }
+        merged_count += count.load(std::memory_order_relaxed);
+        merged_total += total.load(std::memory_order_relaxed);
+        merged_min = std::min(merged_min, min.load(std::memory_order_relaxed));
+        merged_max = std::max(merged_max, max.load(std::memory_order_relaxed));
+    }
 
-        const auto end_time = Clock::now();
-        const auto dur = end_time - start_time_;
-        cerr << id_ << ": "s << duration_cast<milliseconds>(dur).count() << " ms"s << endl;
+    //  ,         O(B)
+    void reset() noexcept
+    {
+        for (std::atomic<uint64_t>& bucket : buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count.store(0, std::memory_order_relaxed);
+        total.store(0, std::memory_order_relaxed);
+        min.store(UINT64_MAX, std::memory_order_relaxed);
+        max.store(0, std::memory_order_relaxed);
+    }
+
+private:
+
+    std::array<std::atomic<uint64_t>, kBuckets> buckets{};
+    std::atomic<uint64_t> count{ 0 };
+    std::atomic<uint64_t> total{ 0 };
+    std::atomic<uint64_t> min{ UINT64_MAX };
+    std::atomic<uint64_t> max{ 0 };
+
+    //       O(1)
+    static void increment(std::atomic<uint64_t>& counter, uint64_t value) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    //    , value != 0 O(1)
+    static size_t highest_bit(uint64_t value) noexcept
+    {
+        size_t bit = 0;
+        while (value >>= 1)
+        {
+            ++bit;
+        }
+        return bit;
+    }
+};
+
+//=======================================================================  ===================================================================
+
+//     
+struct ProfileSummary
+{
+    std::string id;
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    uint64_t min_ns = 0;
+    uint64_t max_ns = 0;
+    uint64_t p50_ns = 0;
+    uint64_t p99_ns = 0;
+    uint64_t p999_ns = 0;
+};
+
+//      .        ,
+//              .
+//       .     
+class Profiler
+{
+public:
+
+    //   
+    static Profiler& instance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    //  ,  -  
+    ~Profiler()
+    {
+        if (exit_report && !summarize().empty())
+        {
+            if (exit_json)
+            {
+                report_json(*exit_report);
+            }
+            else
+            {
+                report(*exit_report);
+            }
+        }
+    }
+
+    //      id,      O(S)
+    size_t site_index(const std::string& id)
+    {
+        std::lock_guard lock(mutex);
+        auto it = std::find(sites.begin(), sites.end(), id);
+        if (it != sites.end())
+        {
+            return it - sites.begin();
+        }
+        sites.push_back(id);
+        return sites.size() - 1;
+    }
+
+    //      site O(1),        O(S)
+    ProfileHistogram& histogram(size_t site)
+    {
+        std::vector<ProfileHistogram*>& local = thread_histograms();
+        if (site >= local.size() || !local[site])
+        {
+            register_histogram(site);
+        }
+        return *local[site];
+    }
+
+    //         site O(1)
+    void record(size_t site, uint64_t nanoseconds)
+    {
+        histogram(site).record(nanoseconds);
+    }
+
+    //      :   ,     O(S * T * B)
+    std::vector<ProfileSummary> summarize() const
+    {
+        std::lock_guard lock(mutex);
+        std::vector<ProfileSummary> result;
+
+        for (size_t site = 0; site < sites.size(); ++site)
+        {
+            std::vector<uint64_t> buckets(ProfileHistogram::kBuckets, 0);
+            ProfileSummary summary;
+            summary.id = sites[site];
+            summary.min_ns = UINT64_MAX;
+
+            for (const Owned& owned : histograms)
+            {
+                if (owned.site == site)
+                {
+                    owned.histogram->merge_into(buckets, summary.count, summary.total_ns, summary.min_ns, summary.max_ns);
+                }
+            }
+            if (summary.count == 0)
+            {
+                continue;
+            }
+
+            summary.p50_ns = percentile(buckets, summary, 0.5);
+            summary.p99_ns = percentile(buckets, summary, 0.99);
+            summary.p999_ns = percentile(buckets, summary, 0.999);
+            result.push_back(std::move(summary));
+        }
+        return result;
+    }
+
+    //    O(S * T * B)
+    void report(std::ostream& out) const
+    {
+        std::vector<ProfileSummary> summaries = summarize();
+
+        size_t width = 8;
+        for (const ProfileSummary& summary : summaries)
+        {
+            width = std::max(width, summary.id.size() + 2);
+        }
+
+        out << std::left << std::setw(static_cast<int>(width)) << "id" << std::right
+            << std::setw(12) << "count" << std::setw(14) << "total ms" << std::setw(14) << "mean ns"
+            << std::setw(12) << "min ns" << std::setw(12) << "p50 ns" << std::setw(12) << "p99 ns"
+            << std::setw(12) << "p999 ns" << std::setw(14) << "max ns" << '\n';
+
+        for (const ProfileSummary& summary : summaries)
+        {
+            out << std::left << std::setw(static_cast<int>(width)) << summary.id << std::right
+                << std::setw(12) << summary.count
+                << std::setw(14) << std::fixed << std::setprecision(3) << summary.total_ns / 1e6
+                << std::setw(14) << std::setprecision(1) << static_cast<double>(summary.total_ns) / summary.count
+                << std::setw(12) << summary.min_ns << std::setw(12) << summary.p50_ns << std::setw(12) << summary.p99_ns
+                << std::setw(12) << summary.p999_ns << std::setw(14) << summary.max_ns << '\n';
+        }
+        out << std::defaultfloat << std::flush;
+    }
+
+    //   JSON: {"sites": [{"id": ..., "count": ..., ...}]} O(S * T * B)
+    void report_json(std::ostream& out) const
+    {
+        std::vector<ProfileSummary> summaries = summarize();
+
+        out << "{\"sites\": [";
+        for (size_t i = 0; i < summaries.size(); ++i)
+        {
+            const ProfileSummary& summary = summaries[i];
+            out << (i ? ", " : "") << "{\"id\": \"" << escape(summary.id) << "\", \"count\": " << summary.count
+                << ", \"total_ns\": " << summary.total_ns << ", \"min_ns\": " << summary.min_ns
+                << ", \"p50_ns\": " << summary.p50_ns << ", \"p99_ns\": " << summary.p99_ns
+                << ", \"p999_ns\": " << summary.p999_ns << ", \"max_ns\": " << summary.max_ns << "}";
+        }
+        out << "]}" << std::endl;
+    }
+
+    //    ,    O(T * B)
+    void reset()
+    {
+        std::lock_guard lock(mutex);
+        for (Owned& owned : histograms)
+        {
+            owned.histogram->reset();
+        }
+    }
+
+    //         , nullptr  
+    void set_exit_report(std::ostream* out, bool json = false)
+    {
+        std::lock_guard lock(mutex);
+        exit_report = out;
+        exit_json = json;
+    }
+
+private:
+
+    struct Owned
+    {
+        size_t site;
+        std::unique_ptr<ProfileHistogram> histogram;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<std::string> sites;
+    std::vector<Owned> histograms;
+    std::ostream* exit_report = &std::cerr;
+    bool exit_json = false;
+
+    Profiler() = default;
+
+    //       O(1)
+    static std::vector<ProfileHistogram*>& thread_histograms()
+    {
+        thread_local std::vector<ProfileHistogram*> local;
+        return local;
+    }
+
+    //       site O(S)
+    void register_histogram(size_t site)
+    {
+        std::vector<ProfileHistogram*>& local = thread_histograms();
+        if (site >= local.size())
+        {
+            local.resize(site + 1, nullptr);
+        }
+
+        std::lock_guard lock(mutex);
+        histograms.push_back({ site, std::make_unique<ProfileHistogram>() });
+        local[site] = histograms.back().histogram.get();
+    }
+
+    //   quantile   ,   min  max O(B)
+    static uint64_t percentile(const std::vector<uint64_t>& buckets, const ProfileSummary& summary, double quantile)
+    {
+        uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(quantile * summary.count + 0.5));
+        uint64_t seen = 0;
+
+        for (size_t i = 0; i < buckets.size(); ++i)
+        {
+            seen += buckets[i];
+            if (seen >= rank)
+            {
+                uint64_t middle = ProfileHistogram::bucket_lower(i) + (ProfileHistogram::bucket_width(i) - 1) / 2;
+                return std::clamp(middle, summary.min_ns, summary.max_ns);
+            }
+        }
+        return summary.max_ns;
+    }
+
+    //  ,        JSON O(N)
+    static std::string escape(const std::string& text)
+    {
+        std::string result;
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                result += '\\';
+                result += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                static const char* hex = "0123456789abcdef";
+                result += "\\u00";
+                result += hex[(c >> 4) & 0xF];
+                result += hex[c & 0xF];
+            }
+            else
+            {
+                result += c;
+            }
+        }
+        return result;
+    }
+};
+
+//         site  .   
+//  ,         
+class ProfileScope
+{
+public:
+
+    using Clock = chrono::steady_clock;
+
+    explicit ProfileScope(size_t site) : histogram(Profiler::instance().histogram(site)){}
+
+    //   ,  ,      O(S)
+    explicit ProfileScope(const std::string& id) : ProfileScope(Profiler::instance().site_index(id)){}
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    ~ProfileScope()
+    {
+        const auto duration = Clock::now() - start_time_;
+        histogram.record(static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(duration).count()));
     }
 
 private:
-    const string id_;
+    ProfileHistogram& histogram;
     const Clock::time_point start_time_ = Clock::now();
-};
\ No newline at end of file
+};
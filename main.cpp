@@ -6,7 +6,7 @@ int main()
 	MemoryLeakDetector detector;
 
 	{
-		LogDuration("Test");
+		LOG_DURATION("Test");
 
 		TestRun();
 	}
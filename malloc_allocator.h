@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+//   malloc/realloc/free.     SimpleVector
+//   reallocate,        
+template <typename Type>
+class MallocAllocator
+{
+    static_assert(alignof(Type) <= alignof(std::max_align_t), "malloc does not guarantee over-aligned storage");
+
+public:
+
+    using value_type = Type;
+    using is_always_equal = std::true_type;
+
+    MallocAllocator() noexcept = default;
+
+    template <typename Other>
+    MallocAllocator(const MallocAllocator<Other>&) noexcept {}
+
+    //    count  O(1)
+    Type* allocate(size_t count)
+    {
+        return static_cast<Type*>(check(std::malloc(bytes(count))));
+    }
+
+    //   O(1)
+    void deallocate(Type* ptr, size_t) noexcept
+    {
+        std::free(ptr);
+    }
+
+    //      ,       O(N)
+    Type* reallocate(Type* ptr, size_t, size_t new_count)
+    {
+        return static_cast<Type*>(check(std::realloc(static_cast<void*>(ptr), bytes(new_count))));
+    }
+
+    template <typename Other>
+    bool operator==(const MallocAllocator<Other>&) const noexcept
+    {
+        return true;
+    }
+
+private:
+
+    //        O(1)
+    static size_t bytes(size_t count)
+    {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(Type))
+        {
+            throw std::bad_array_new_length();
+        }
+        return count * sizeof(Type);
+    }
+
+    //     O(1)
+    static void* check(void* ptr)
+    {
+        if (!ptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+};
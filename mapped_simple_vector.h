@@ -0,0 +1,573 @@
+#pragma once
+
+#include "growth_policy.h"
+#include "simd_algorithms.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ,        
+class MappedFile
+{
+public:
+
+    //  ,    
+    explicit MappedFile(const std::string& path)
+    {
+#if defined(_WIN32)
+        file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+            OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw_last_error("CreateFile");
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size))
+        {
+            throw_last_error("GetFileSizeEx");
+        }
+        size = static_cast<size_t>(file_size.QuadPart);
+#else
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0)
+        {
+            throw_last_error("open");
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0)
+        {
+            throw_last_error("fstat");
+        }
+        size = static_cast<size_t>(info.st_size);
+#endif
+        map();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    //  
+    MappedFile(MappedFile&& other) noexcept
+    {
+        swap(other);
+    }
+
+    //   
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            MappedFile temp(std::move(other));
+            swap(temp);
+        }
+        return *this;
+    }
+
+    //     
+    ~MappedFile()
+    {
+        unmap();
+#if defined(_WIN32)
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+        }
+#else
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+#endif
+    }
+
+    //   O(1)
+    char* data() const noexcept
+    {
+        return view;
+    }
+
+    //     O(1)
+    size_t get_size() const noexcept
+    {
+        return size;
+    }
+
+    //       ,     O(1)
+    void resize(size_t new_size)
+    {
+#if defined(_WIN32)
+        unmap();
+
+        LARGE_INTEGER position;
+        position.QuadPart = static_cast<LONGLONG>(new_size);
+        if (!SetFilePointerEx(file, position, nullptr, FILE_BEGIN) || !SetEndOfFile(file))
+        {
+            throw_last_error("SetEndOfFile");
+        }
+        size = new_size;
+        map();
+#else
+        if (ftruncate(fd, static_cast<off_t>(new_size)) != 0)
+        {
+            throw_last_error("ftruncate");
+        }
+#if defined(__linux__)
+        if (view && new_size > 0)
+        {
+            void* result = mremap(view, size, new_size, MREMAP_MAYMOVE);
+            if (result == MAP_FAILED)
+            {
+                throw_last_error("mremap");
+            }
+            view = static_cast<char*>(result);
+            size = new_size;
+            return;
+        }
+#endif
+        unmap();
+        size = new_size;
+        map();
+#endif
+    }
+
+    //      O(N)
+    void sync()
+    {
+        if (!view)
+        {
+            return;
+        }
+#if defined(_WIN32)
+        if (!FlushViewOfFile(view, 0) || !FlushFileBuffers(file))
+        {
+            throw_last_error("FlushViewOfFile");
+        }
+#else
+        if (msync(view, size, MS_SYNC) != 0)
+        {
+            throw_last_error("msync");
+        }
+#endif
+    }
+
+    //   O(1)
+    void swap(MappedFile& other) noexcept
+    {
+#if defined(_WIN32)
+        std::swap(file, other.file);
+        std::swap(mapping, other.mapping);
+#else
+        std::swap(fd, other.fd);
+#endif
+        std::swap(view, other.view);
+        std::swap(size, other.size);
+    }
+
+private:
+
+#if defined(_WIN32)
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+    char* view = nullptr;
+    size_t size = 0;
+
+    //   ,     O(1)
+    void map()
+    {
+        if (size == 0)
+        {
+            return;
+        }
+#if defined(_WIN32)
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+        if (!mapping)
+        {
+            throw_last_error("CreateFileMapping");
+        }
+        view = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+        if (!view)
+        {
+            throw_last_error("MapViewOfFile");
+        }
+#else
+        void* result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (result == MAP_FAILED)
+        {
+            throw_last_error("mmap");
+        }
+        view = static_cast<char*>(result);
+#endif
+    }
+
+    //   O(1)
+    void unmap() noexcept
+    {
+#if defined(_WIN32)
+        if (view)
+        {
+            UnmapViewOfFile(view);
+        }
+        if (mapping)
+        {
+            CloseHandle(mapping);
+            mapping = nullptr;
+        }
+#else
+        if (view)
+        {
+            munmap(view, size);
+        }
+#endif
+        view = nullptr;
+    }
+
+    //      
+    [[noreturn]] static void throw_last_error(const char* what)
+    {
+#if defined(_WIN32)
+        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), what);
+#else
+        throw std::system_error(errno, std::generic_category(), what);
+#endif
+    }
+};
+
+//   MappedSimpleVector
+struct MappedVectorHeader
+{
+    static constexpr uint64_t kMagic = 0x524F544345565653ull; // "SVVECTOR"
+    static constexpr uint32_t kVersion = 1;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t type_size;
+    uint64_t size;
+    uint64_t capacity;
+};
+
+//    ,      .
+//       
+template <typename Type, typename GrowthPolicy = DoublingGrowth>
+class MappedSimpleVector
+{
+    static_assert(std::is_trivially_copyable_v<Type>, "MappedSimpleVector stores raw bytes of its elements");
+
+public:
+
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    //     ,   Type
+    static constexpr size_t kDataOffset = (sizeof(MappedVectorHeader) + alignof(Type) - 1) / alignof(Type) * alignof(Type);
+
+//=====================================================================    ==========================================================
+
+    //     path   .  std::runtime_error   
+    explicit MappedSimpleVector(const std::string& path) : file(path)
+    {
+        if (file.get_size() == 0)
+        {
+            file.resize(kDataOffset);
+
+            MappedVectorHeader* created = header();
+            created->magic = MappedVectorHeader::kMagic;
+            created->version = MappedVectorHeader::kVersion;
+            created->type_size = sizeof(Type);
+            created->size = 0;
+            created->capacity = 0;
+            return;
+        }
+
+        if (file.get_size() < kDataOffset)
+        {
+            throw std::runtime_error("Mapped vector file is truncated");
+        }
+
+        const MappedVectorHeader* opened = header();
+        if (opened->magic != MappedVectorHeader::kMagic || opened->version != MappedVectorHeader::kVersion)
+        {
+            throw std::runtime_error("File is not a mapped vector of a supported version");
+        }
+        if (opened->type_size != sizeof(Type))
+        {
+            throw std::runtime_error("Mapped vector element size mismatch");
+        }
+        if (opened->size > opened->capacity || kDataOffset + opened->capacity * sizeof(Type) > file.get_size())
+        {
+            throw std::runtime_error("Mapped vector header is corrupted");
+        }
+    }
+
+    MappedSimpleVector(const MappedSimpleVector&) = delete;
+    MappedSimpleVector& operator=(const MappedSimpleVector&) = delete;
+
+    MappedSimpleVector(MappedSimpleVector&&) noexcept = default;
+    MappedSimpleVector& operator=(MappedSimpleVector&&) noexcept = default;
+
+//================================================================  ===============================================================================
+
+    //     O(1)
+    Type& operator[](size_t index) noexcept
+    {
+        assert(index < get_size());
+        return data()[index];
+    }
+
+    //      O(1)
+    const Type& operator[](size_t index) const noexcept
+    {
+        assert(index < get_size());
+        return data()[index];
+    }
+
+//=====================================================================  ==========================================================================
+
+    //    O(1)
+    Iterator begin() noexcept
+    {
+        return data();
+    }
+
+    //    O(1)
+    Iterator end() noexcept
+    {
+        return data() + get_size();
+    }
+
+    //     O(1)
+    ConstIterator begin() const noexcept
+    {
+        return data();
+    }
+
+    //     O(1)
+    ConstIterator end() const noexcept
+    {
+        return data() + get_size();
+    }
+
+    // O(1)
+    ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    // O(1)
+    ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+//=====================================================================  =============================================================================
+
+    //   ,      O(N)
+    void push_back(const Type& item)
+    {
+        size_t size = get_size();
+        if (size == get_capacity())
+        {
+            Type copy = item; // item    ,  
+            reserve(GrowthPolicy::next_capacity(get_capacity(), size + 1, sizeof(Type)));
+            data()[size] = copy;
+        }
+        else
+        {
+            data()[size] = item;
+        }
+        header()->size = size + 1;
+    }
+
+    //    O(1)
+    void pop_back() noexcept
+    {
+        assert(get_size() > 0);
+        --header()->size;
+    }
+
+    //  ,       O(N)
+    void resize(size_t new_size)
+    {
+        size_t size = get_size();
+        if (new_size > get_capacity())
+        {
+            reserve(GrowthPolicy::next_capacity(get_capacity(), new_size, sizeof(Type)));
+        }
+        for (size_t i = size; i < new_size; ++i)
+        {
+            data()[i] = Type();
+        }
+        header()->size = new_size;
+    }
+
+    //     O(1)
+    void reserve(size_t new_capacity)
+    {
+        if (new_capacity > get_capacity())
+        {
+            if (new_capacity > (std::numeric_limits<size_t>::max() - kDataOffset) / sizeof(Type))
+            {
+                throw std::length_error("Mapped vector capacity is too large");
+            }
+            file.resize(kDataOffset + new_capacity * sizeof(Type));
+            header()->capacity = new_capacity;
+        }
+    }
+
+    //  ,    O(1)
+    void clear() noexcept
+    {
+        header()->size = 0;
+    }
+
+    //     O(N)
+    void sync()
+    {
+        file.sync();
+    }
+
+    //  ,      0 O(1)
+    size_t get_size() const noexcept
+    {
+        return file.data() ? static_cast<size_t>(header()->size) : 0;
+    }
+
+    // ,      0 O(1)
+    size_t get_capacity() const noexcept
+    {
+        return file.data() ? static_cast<size_t>(header()->capacity) : 0;
+    }
+
+    //    O(1)
+    bool is_empty() const noexcept
+    {
+        return get_size() == 0;
+    }
+
+    //     O(1)
+    Type& front()
+    {
+        if (is_empty())
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return data()[0];
+    }
+
+    //      O(1)
+    const Type& front() const
+    {
+        if (is_empty())
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return data()[0];
+    }
+
+    //     O(1)
+    Type& back()
+    {
+        if (is_empty())
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return data()[get_size() - 1];
+    }
+
+    //     O(1)
+    const Type& back() const
+    {
+        if (is_empty())
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return data()[get_size() - 1];
+    }
+
+    //      O(1)
+    Type& at(size_t index)
+    {
+        if (index >= get_size())
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return data()[index];
+    }
+
+    //       O(1)
+    const Type& at(size_t index) const
+    {
+        if (index >= get_size())
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return data()[index];
+    }
+
+    //     O(1)
+    Type* data() noexcept
+    {
+        return file.data() ? reinterpret_cast<Type*>(file.data() + kDataOffset) : nullptr;
+    }
+
+    //      O(1)
+    const Type* data() const noexcept
+    {
+        return file.data() ? reinterpret_cast<const Type*>(file.data() + kDataOffset) : nullptr;
+    }
+
+private:
+
+    MappedFile file;
+
+    //     O(1)
+    MappedVectorHeader* header() noexcept
+    {
+        return reinterpret_cast<MappedVectorHeader*>(file.data());
+    }
+
+    //      O(1)
+    const MappedVectorHeader* header() const noexcept
+    {
+        return reinterpret_cast<const MappedVectorHeader*>(file.data());
+    }
+};
+
+//=================================================    =========================================================
+
+template <typename Type, typename GrowthPolicy>
+inline bool operator==(const MappedSimpleVector<Type, GrowthPolicy>& lhs, const MappedSimpleVector<Type, GrowthPolicy>& rhs)
+{
+    return simd_equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, typename GrowthPolicy>
+inline bool operator!=(const MappedSimpleVector<Type, GrowthPolicy>& lhs, const MappedSimpleVector<Type, GrowthPolicy>& rhs)
+{
+    return !(lhs == rhs);
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+//       
+enum class HugePages
+{
+    Off,            //  
+    Transparent,    // MADV_HUGEPAGE,    2MB 
+    Explicit2M,     // MAP_HUGETLB  2MB     
+    Explicit1G      // MAP_HUGETLB  1GB     
+};
+
+// ,     Threshold   mmap (VirtualAlloc  Windows),
+//     .      mremap   .
+//     SimpleVector  reallocate 
+template <typename Type, size_t Threshold = (size_t(256) << 20), HugePages Mode = HugePages::Transparent>
+class MmapAllocator
+{
+public:
+
+    using value_type = Type;
+    using is_always_equal = std::true_type;
+
+    template <typename Other>
+    struct rebind
+    {
+        using other = MmapAllocator<Other, Threshold, Mode>;
+    };
+
+    MmapAllocator() noexcept = default;
+
+    template <typename Other>
+    MmapAllocator(const MmapAllocator<Other, Threshold, Mode>&) noexcept {}
+
+    //    count  O(1)
+    Type* allocate(size_t count)
+    {
+        size_t size = bytes(count);
+        if (!is_mapped(size))
+        {
+            return std::allocator<Type>().allocate(count);
+        }
+        return static_cast<Type*>(map(size));
+    }
+
+    //    count  O(1)
+    void deallocate(Type* ptr, size_t count) noexcept
+    {
+        size_t size = count * sizeof(Type);
+        if (!is_mapped(size))
+        {
+            std::allocator<Type>().deallocate(ptr, count);
+            return;
+        }
+        unmap(ptr, size);
+    }
+
+    //      .    mremap  
+    //    ,    min(old, new)  O(N)
+    Type* reallocate(Type* ptr, size_t old_count, size_t new_count)
+    {
+        size_t old_size = old_count * sizeof(Type);
+        size_t new_size = bytes(new_count);
+
+#if defined(__linux__)
+        if (Mode != HugePages::Explicit2M && Mode != HugePages::Explicit1G && is_mapped(old_size) && is_mapped(new_size))
+        {
+            void* result = mremap(ptr, mapped_size(old_size), mapped_size(new_size), MREMAP_MAYMOVE);
+            if (result == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<Type*>(result);
+        }
+#endif
+
+        Type* result = allocate(new_count);
+        std::memcpy(static_cast<void*>(result), static_cast<const void*>(ptr), std::min(old_size, new_size));
+        deallocate(ptr, old_count);
+
+        return result;
+    }
+
+    template <typename Other>
+    bool operator==(const MmapAllocator<Other, Threshold, Mode>&) const noexcept
+    {
+        return true;
+    }
+
+private:
+
+    //        O(1)
+    static size_t bytes(size_t count)
+    {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(Type))
+        {
+            throw std::bad_array_new_length();
+        }
+        return count * sizeof(Type);
+    }
+
+    //    ,      O(1)
+    static bool is_mapped(size_t size) noexcept
+    {
+        return size >= Threshold && size > 0;
+    }
+
+    //  :      O(1)
+    static size_t granularity() noexcept
+    {
+        switch (Mode)
+        {
+        case HugePages::Transparent:
+        case HugePages::Explicit2M:
+            return size_t(2) << 20;
+        case HugePages::Explicit1G:
+            return size_t(1) << 30;
+        default:
+            break;
+        }
+#if defined(_WIN32)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwAllocationGranularity;
+#else
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    //  ,    O(1)
+    static size_t mapped_size(size_t size) noexcept
+    {
+        size_t page = granularity();
+        return (size + page - 1) / page * page;
+    }
+
+    //   ,       O(1)
+    static void* map(size_t size)
+    {
+        size_t length = mapped_size(size);
+
+#if defined(_WIN32)
+        void* ptr = VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (!ptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+#else
+        void* ptr = MAP_FAILED;
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+        if (Mode == HugePages::Explicit2M || Mode == HugePages::Explicit1G)
+        {
+            int page_shift = Mode == HugePages::Explicit2M ? 21 : 30;
+            ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (page_shift << MAP_HUGE_SHIFT), -1, 0);
+        }
+#endif
+        if (ptr == MAP_FAILED)
+        {
+            ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+#if defined(MADV_HUGEPAGE)
+            if (Mode != HugePages::Off)
+            {
+                madvise(ptr, length, MADV_HUGEPAGE);
+            }
+#endif
+        }
+        return ptr;
+#endif
+    }
+
+    //   O(1)
+    static void unmap(void* ptr, size_t size) noexcept
+    {
+#if defined(_WIN32)
+        (void)size;
+        VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+        munmap(ptr, mapped_size(size));
+#endif
+    }
+};
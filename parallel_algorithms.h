@@ -0,0 +1,378 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+
+//       .     
+// :     i       , 
+// ,    ,    ,    
+class ThreadPool
+{
+public:
+
+    //    thread_count ,   
+    explicit ThreadPool(size_t thread_count = std::thread::hardware_concurrency())
+    {
+        thread_count = std::max<size_t>(thread_count, 1);
+        workers.reserve(thread_count - 1);
+
+        try
+        {
+            for (size_t i = 1; i < thread_count; ++i)
+            {
+                workers.emplace_back([this, i] { work(i); });
+            }
+        }
+        catch (...)
+        {
+            //     ,   std::thread  std::terminate
+            stop();
+            throw;
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //     
+    ~ThreadPool()
+    {
+        stop();
+    }
+
+    //  ,    O(1)
+    size_t get_size() const noexcept
+    {
+        return workers.get_size() + 1;
+    }
+
+    //  [0, count)     min_chunk   function(first, last)     .
+    //     ,    .  
+    template <typename Function>
+    void run(size_t count, Function&& function, size_t min_chunk = 4096)
+    {
+        size_t participants = std::min(get_size(), std::max<size_t>(1, count / std::max<size_t>(min_chunk, 1)));
+
+        auto task = [&](size_t index)
+        {
+            function(count * index / participants, count * (index + 1) / participants);
+        };
+
+        if (participants == 1)
+        {
+            task(0);
+            return;
+        }
+
+        std::lock_guard run_lock(run_mutex);
+        {
+            std::lock_guard lock(mutex);
+            job = [](void* context, size_t index) { (*static_cast<decltype(task)*>(context))(index); };
+            job_context = &task;
+            active = participants;
+            pending = workers.get_size();
+            error = nullptr;
+            ++generation;
+        }
+        wake.notify_all();
+
+        execute(0);
+
+        std::unique_lock lock(mutex);
+        done.wait(lock, [this] { return pending == 0; });
+
+        if (error)
+        {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+
+private:
+
+    SimpleVector<std::thread> workers;
+
+    std::mutex run_mutex;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    void (*job)(void*, size_t) = nullptr;
+    void* job_context = nullptr;
+    size_t active = 0;
+    size_t pending = 0;
+    size_t generation = 0;
+    bool stopping = false;
+    std::exception_ptr error;
+
+    //      
+    void stop() noexcept
+    {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    //   index  ,   
+    void execute(size_t index) noexcept
+    {
+        try
+        {
+            job(job_context, index);
+        }
+        catch (...)
+        {
+            std::lock_guard lock(mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    //       index
+    void work(size_t index)
+    {
+        size_t seen = 0;
+        std::unique_lock lock(mutex);
+
+        for (;;)
+        {
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+            {
+                return;
+            }
+            seen = generation;
+
+            if (index < active)
+            {
+                lock.unlock();
+                execute(index);
+                lock.lock();
+            }
+            if (--pending == 0)
+            {
+                done.notify_one();
+            }
+        }
+    }
+};
+
+//       
+inline ThreadPool& default_thread_pool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+//=================================================      ===================================================
+
+//  value    O(N / P)
+template <typename Container, typename Value>
+void parallel_fill(Container& container, const Value& value, ThreadPool& pool = default_thread_pool())
+{
+    auto* data = container.data();
+    pool.run(container.get_size(), [&](size_t first, size_t last)
+    {
+        std::fill(data + first, data + last, value);
+    });
+}
+
+//  operation(source[i])  destination[i], destination   source      O(N / P)
+template <typename Source, typename Destination, typename UnaryOperation>
+void parallel_transform(const Source& source, Destination& destination, UnaryOperation operation,
+    ThreadPool& pool = default_thread_pool())
+{
+    assert(destination.get_size() >= source.get_size());
+
+    const auto* input = source.data();
+    auto* output = destination.data();
+    pool.run(source.get_size(), [&](size_t first, size_t last)
+    {
+        std::transform(input + first, input + last, output + first, operation);
+    });
+}
+
+//   :   ,     init O(N / P + P)
+template <typename Container, typename Value, typename BinaryOperation>
+Value parallel_reduce(const Container& container, Value init, BinaryOperation operation,
+    ThreadPool& pool = default_thread_pool())
+{
+    const auto* data = container.data();
+    const size_t count = container.get_size();
+    const size_t chunks = pool.get_size();
+
+    SimpleVector<std::optional<Value>> partial(chunks);
+    pool.run(chunks, [&](size_t first_chunk, size_t last_chunk)
+    {
+        for (size_t chunk = first_chunk; chunk < last_chunk; ++chunk)
+        {
+            size_t first = count * chunk / chunks;
+            size_t last = count * (chunk + 1) / chunks;
+            if (first == last)
+            {
+                continue;
+            }
+
+            Value accumulator = data[first];
+            for (size_t i = first + 1; i < last; ++i)
+            {
+                accumulator = operation(std::move(accumulator), data[i]);
+            }
+            partial[chunk] = std::move(accumulator);
+        }
+    }, 1);
+
+    for (std::optional<Value>& value : partial)
+    {
+        if (value)
+        {
+            init = operation(std::move(init), std::move(*value));
+        }
+    }
+    return init;
+}
+
+// :   ,     log P  O(N log N / P + N log P)
+template <typename Container, typename Compare = std::less<>>
+void parallel_sort(Container& container, Compare compare = Compare(), ThreadPool& pool = default_thread_pool())
+{
+    auto* data = container.data();
+    const size_t count = container.get_size();
+    const size_t chunks = std::min(pool.get_size(), std::max<size_t>(1, count / 4096));
+
+    auto bound = [&](size_t chunk)
+    {
+        return data + count * std::min(chunk, chunks) / chunks;
+    };
+
+    pool.run(chunks, [&](size_t first_chunk, size_t last_chunk)
+    {
+        for (size_t chunk = first_chunk; chunk < last_chunk; ++chunk)
+        {
+            std::sort(bound(chunk), bound(chunk + 1), compare);
+        }
+    }, 1);
+
+    for (size_t width = 1; width < chunks; width *= 2)
+    {
+        size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+        pool.run(pairs, [&](size_t first_pair, size_t last_pair)
+        {
+            for (size_t pair = first_pair; pair < last_pair; ++pair)
+            {
+                size_t left = pair * 2 * width;
+                std::inplace_merge(bound(left), bound(left + width), bound(left + 2 * width), compare);
+            }
+        }, 1);
+    }
+}
+
+//   [destination, destination + count)       :
+// construct(elements, first, last)   ArrayPtr   allocator    .
+//  -   ,       
+//  O(N / P)
+template <typename Type, typename Allocator, typename ChunkConstructor>
+void parallel_construct(Type* destination, size_t count, const Allocator& allocator, ThreadPool& pool, ChunkConstructor construct)
+{
+    const size_t chunks = pool.get_size();
+    SimpleVector<char> constructed(chunks, 0);
+
+    try
+    {
+        pool.run(chunks, [&](size_t first_chunk, size_t last_chunk)
+        {
+            ArrayPtr<Type, Allocator> elements(allocator);
+            for (size_t chunk = first_chunk; chunk < last_chunk; ++chunk)
+            {
+                construct(elements, destination + count * chunk / chunks, destination + count * (chunk + 1) / chunks);
+                constructed[chunk] = 1;
+            }
+        }, 1);
+    }
+    catch (...)
+    {
+        ArrayPtr<Type, Allocator> elements(allocator);
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            if (constructed[chunk])
+            {
+                elements.destroy(destination + count * chunk / chunks, destination + count * (chunk + 1) / chunks);
+            }
+        }
+        throw;
+    }
+}
+
+//    count  value,     ,
+//         . value  
+//    O(N / P)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void parallel_assign(SimpleVector<Type, Allocator, GrowthPolicy>& vector, size_t count, const Type& value,
+    ThreadPool& pool = default_thread_pool())
+{
+    //    ,    value   
+    const Type filler(value);
+    const Allocator allocator = vector.get_allocator();
+
+    vector.clear();
+    vector.reserve(count);
+    vector.append_constructed(count, [&](Type* destination, Type*)
+    {
+        parallel_construct(destination, count, allocator, pool, [&](ArrayPtr<Type, Allocator>& elements, Type* first, Type* last)
+        {
+            elements.uninitialized_fill(first, last - first, filler);
+        });
+    });
+}
+
+//     source,   .  source
+//     ,         O(N / P)
+template <typename Type, typename Allocator, typename GrowthPolicy, typename Source>
+void parallel_copy(const Source& source, SimpleVector<Type, Allocator, GrowthPolicy>& vector,
+    ThreadPool& pool = default_thread_pool())
+{
+    const auto* input = source.data();
+    const size_t count = source.get_size();
+
+    if constexpr (std::is_same_v<std::remove_cv_t<std::remove_pointer_t<decltype(input)>>, Type>)
+    {
+        std::less<const Type*> less;
+        if (count != 0 && less(input, vector.data() + vector.get_size()) && less(vector.data(), input + count))
+        {
+            SimpleVector<Type, Allocator, GrowthPolicy> copy(vector.get_allocator());
+            parallel_copy(source, copy, pool);
+            vector = std::move(copy);
+            return;
+        }
+    }
+
+    const Allocator allocator = vector.get_allocator();
+
+    vector.clear();
+    vector.reserve(count);
+    vector.append_constructed(count, [&](Type* destination, Type*)
+    {
+        parallel_construct(destination, count, allocator, pool, [&](ArrayPtr<Type, Allocator>& elements, Type* first, Type* last)
+        {
+            elements.uninitialized_copy(input + (first - destination), input + (last - destination), first);
+        });
+    });
+}
@@ -0,0 +1,1297 @@
+#pragma once
+
+#include "simple_vector.h"
+#include "simple_vector_view.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+template <typename Type>
+class TransientSimpleVector;
+
+//    RRB- (relaxed radix balanced tree)   .   
+//   ,   ,       .
+//       32 ,      ,
+//         .       ,
+//  push_back    .        
+template <typename Type>
+class PersistentSimpleVector
+{
+public:
+
+    static constexpr size_t kBits = 5;
+    static constexpr size_t kBranching = size_t(1) << kBits;
+
+    class ConstIterator;
+    using Iterator = ConstIterator;
+
+//=====================================================================    ==========================================================
+
+    PersistentSimpleVector() noexcept = default;
+
+    //     {}
+    PersistentSimpleVector(std::initializer_list<Type> init) : PersistentSimpleVector(SimpleVectorView<const Type>(init.begin(), init.size())){}
+
+    //       ,  SimpleVector O(N)
+    explicit PersistentSimpleVector(SimpleVectorView<const Type> items)
+    {
+        for (const Type& item : items)
+        {
+            append(item, true);
+        }
+    }
+
+    //      O(1)
+    PersistentSimpleVector(const PersistentSimpleVector& other) noexcept
+        : root(other.root), tail(other.tail), tree_size(other.tree_size), size(other.size)
+    {
+        retain(root);
+        retain(tail);
+    }
+
+    //  
+    PersistentSimpleVector(PersistentSimpleVector&& other) noexcept
+        : root(std::exchange(other.root, nullptr)), tail(std::exchange(other.tail, nullptr)),
+        tree_size(std::exchange(other.tree_size, 0)), size(std::exchange(other.size, 0)){}
+
+    //  ,      O(N)   
+    ~PersistentSimpleVector()
+    {
+        release(root);
+        release(tail);
+    }
+
+//================================================================  ===============================================================================
+
+    //      O(log N)
+    const Type& operator[](size_t index) const noexcept
+    {
+        assert(index < size);
+
+        size_t leaf_first = 0;
+        const Leaf* leaf = find_leaf(index, leaf_first);
+        return leaf->items()[index - leaf_first];
+    }
+
+    //    rhs O(1)
+    PersistentSimpleVector& operator=(const PersistentSimpleVector& rhs) noexcept
+    {
+        PersistentSimpleVector temp(rhs);
+        swap(temp);
+        return *this;
+    }
+
+    //   O(1)
+    PersistentSimpleVector& operator=(PersistentSimpleVector&& rhs) noexcept
+    {
+        PersistentSimpleVector temp(std::move(rhs));
+        swap(temp);
+        return *this;
+    }
+
+//=====================================================================  ==========================================================================
+
+    //    O(1)
+    ConstIterator begin() const noexcept
+    {
+        return ConstIterator(this, 0);
+    }
+
+    //    O(1)
+    ConstIterator end() const noexcept
+    {
+        return ConstIterator(this, size);
+    }
+
+    // O(1)
+    ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    // O(1)
+    ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+//=====================================================================  =============================================================================
+
+//---------------------------------------------------------------------   -----------------------------------------------------------------------
+
+    //   value  .  ,    -     O(log N)
+    [[nodiscard]] PersistentSimpleVector push_back(const Type& value) const
+    {
+        PersistentSimpleVector result(*this);
+        result.append(value, false);
+        return result;
+    }
+
+    //   value   index.       O(log N)
+    [[nodiscard]] PersistentSimpleVector set(size_t index, const Type& value) const
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Out of range");
+        }
+
+        PersistentSimpleVector result(*this);
+        result.assign(index, value, false);
+        return result;
+    }
+
+    //    [first, last).      O(log N)
+    [[nodiscard]] PersistentSimpleVector slice(size_t first, size_t last) const
+    {
+        if (first > last || last > size)
+        {
+            throw std::out_of_range("Slice is out of range");
+        }
+
+        PersistentSimpleVector result(*this);
+        result.take(last);
+        result.drop(first);
+        return result;
+    }
+
+    //       other.      
+    //   ,       O(log N)
+    [[nodiscard]] PersistentSimpleVector concat(const PersistentSimpleVector& other) const
+    {
+        if (other.size == 0)
+        {
+            return *this;
+        }
+        if (size == 0)
+        {
+            return other;
+        }
+
+        PersistentSimpleVector result(*this);
+        if (!other.root)
+        {
+            for (const Type& item : SimpleVectorView<const Type>(other.tail->items(), other.size))
+            {
+                result.append(item, false);
+            }
+            return result;
+        }
+
+        if (result.size > result.tree_size)
+        {
+            result.push_tail(false);
+        }
+
+        if (!result.root)
+        {
+            result.root = other.root;
+            retain(result.root);
+        }
+        else
+        {
+            Node* merged = concat_subtree(result.root, other.root, true);
+            release(result.root);
+            result.root = merged;
+            result.collapse();
+        }
+
+        result.tree_size += other.tree_size;
+        result.tail = other.tail;
+        retain(result.tail);
+        result.size += other.size;
+
+        return result;
+    }
+
+//--------------------------------------------------------------   ------------------------------------------------------------------------
+
+    //   O(1)
+    size_t get_size() const noexcept
+    {
+        return size;
+    }
+
+    //    O(1)
+    bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    //         O(log N)
+    const Type& at(size_t index) const
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return (*this)[index];
+    }
+
+    //      O(log N)
+    const Type& front() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[0];
+    }
+
+    //      O(1)
+    const Type& back() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[size - 1];
+    }
+
+    //     , 0      O(1)
+    size_t get_depth() const noexcept
+    {
+        return root ? root->height : 0;
+    }
+
+//---------------------------------------------------------------------   ----------------------------------------------------------------------
+
+    // ,    .           O(1)
+    TransientSimpleVector<Type> transient() const
+    {
+        return TransientSimpleVector<Type>(*this);
+    }
+
+    //   ,     O(N)
+    template <typename Allocator = std::allocator<Type>, typename GrowthPolicy = DoublingGrowth>
+    SimpleVector<Type, Allocator, GrowthPolicy> to_simple_vector(const Allocator& alloc = Allocator()) const
+    {
+        SimpleVector<Type, Allocator, GrowthPolicy> result(alloc);
+        result.reserve(size);
+        for_each_leaf(root, [&](const Leaf* leaf)
+        {
+            result.append_range(leaf->items(), leaf->items() + leaf->count);
+        });
+        if (tail)
+        {
+            result.append_range(tail->items(), tail->items() + tail->count);
+        }
+        return result;
+    }
+
+    //   O(1)
+    void swap(PersistentSimpleVector& other) noexcept
+    {
+        std::swap(root, other.root);
+        std::swap(tail, other.tail);
+        std::swap(tree_size, other.tree_size);
+        std::swap(size, other.size);
+    }
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------------
+
+private:
+
+    friend class TransientSimpleVector<Type>;
+
+    //         
+    static constexpr size_t kExtraNodes = 2;
+
+    //   :  ,      (0 - )
+    struct Node
+    {
+        std::atomic<size_t> references{ 1 };
+        size_t count = 0;
+        size_t height = 0;
+    };
+
+    // :  kBranching     
+    struct Leaf : Node
+    {
+        alignas(Type) unsigned char storage[kBranching * sizeof(Type)];
+
+        Leaf() noexcept = default;
+        Leaf(const Leaf&) = delete;
+        Leaf& operator=(const Leaf&) = delete;
+
+        ~Leaf()
+        {
+            std::destroy_n(items(), this->count);
+        }
+
+        Type* items() noexcept
+        {
+            return reinterpret_cast<Type*>(storage);
+        }
+
+        const Type* items() const noexcept
+        {
+            return reinterpret_cast<const Type*>(storage);
+        }
+    };
+
+    //  :      
+    struct Branch : Node
+    {
+        Node* children[kBranching];
+        size_t sizes[kBranching];
+
+        explicit Branch(size_t height) noexcept
+        {
+            this->height = height;
+        }
+
+        Branch(const Branch&) = delete;
+        Branch& operator=(const Branch&) = delete;
+
+        ~Branch()
+        {
+            for (size_t i = 0; i < this->count; ++i)
+            {
+                release(children[i]);
+            }
+        }
+
+        //     O(1)
+        size_t total() const noexcept
+        {
+            return this->count ? sizes[this->count - 1] : 0;
+        }
+
+        // ,   index.      32^height ,
+        //    radix-         O(1)   
+        size_t find_slot(size_t index) const noexcept
+        {
+            size_t shift = kBits * this->height;
+            size_t slot = shift < 64 ? std::min(index >> shift, this->count - 1) : 0;
+            while (sizes[slot] <= index)
+            {
+                ++slot;
+            }
+            return slot;
+        }
+
+        //  ,     O(1)
+        void append(Node* child) noexcept
+        {
+            assert(this->count < kBranching);
+            sizes[this->count] = (this->count ? sizes[this->count - 1] : 0) + node_size(child);
+            children[this->count++] = child;
+        }
+
+        //   slot  updated,    ,    O(K)
+        void replace(size_t slot, Node* updated) noexcept
+        {
+            if (children[slot] != updated)
+            {
+                release(children[slot]);
+                children[slot] = updated;
+            }
+            for (size_t i = slot; i < this->count; ++i)
+            {
+                sizes[i] = (i ? sizes[i - 1] : 0) + node_size(children[i]);
+            }
+        }
+    };
+
+    Node* root = nullptr;       //      1  nullptr
+    Leaf* tail = nullptr;       //      nullptr
+    size_t tree_size = 0;
+    size_t size = 0;
+
+//------------------------------------------------------------------------  ----------------------------------------------------------------------------
+
+    static void retain(Node* node) noexcept
+    {
+        if (node)
+        {
+            node->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    //  ,         O(K)
+    static void release(Node* node) noexcept
+    {
+        if (node && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            if (node->height == 0)
+            {
+                delete static_cast<Leaf*>(node);
+            }
+            else
+            {
+                delete static_cast<Branch*>(node);
+            }
+        }
+    }
+
+    //     :         O(1)
+    static bool is_editable(const Node* node, bool transient) noexcept
+    {
+        return transient && node->references.load(std::memory_order_acquire) == 1;
+    }
+
+    //      O(1)
+    static size_t node_size(const Node* node) noexcept
+    {
+        return node->height == 0 ? node->count : static_cast<const Branch*>(node)->total();
+    }
+
+    //  ,   :     O(1)
+    static size_t slots(const Node* node) noexcept
+    {
+        return node->count;
+    }
+
+    //      [first, last)  source O(K)
+    static Leaf* copy_leaf(const Leaf* source, size_t first, size_t last)
+    {
+        std::unique_ptr<Leaf> leaf(new Leaf);
+        for (size_t i = first; i < last; ++i)
+        {
+            std::construct_at(leaf->items() + leaf->count, source->items()[i]);
+            ++leaf->count;
+        }
+        return leaf.release();
+    }
+
+    //      [first, last)  source,    O(K)
+    static Branch* copy_branch(const Branch* source, size_t first, size_t last)
+    {
+        Branch* branch = new Branch(source->height);
+        for (size_t i = first; i < last; ++i)
+        {
+            retain(source->children[i]);
+            branch->append(source->children[i]);
+        }
+        return branch;
+    }
+
+    //      height   leaf,  leaf  .
+    //       leaf  O(log N)
+    static Node* new_path(size_t height, Node* leaf)
+    {
+        Node* node = leaf;
+        try
+        {
+            for (size_t level = 1; level <= height; ++level)
+            {
+                Branch* parent = new Branch(level);
+                parent->append(node);
+                node = parent;
+            }
+        }
+        catch (...)
+        {
+            release(node);
+            throw;
+        }
+        return node;
+    }
+
+    //  node   slot,   updated:  node,    ,  .
+    //     updated  O(K)
+    static Branch* replace_child(Branch* node, bool editable, size_t slot, Node* updated)
+    {
+        Branch* target = node;
+        if (!editable)
+        {
+            try
+            {
+                target = copy_branch(node, 0, node->count);
+            }
+            catch (...)
+            {
+                if (updated != node->children[slot])
+                {
+                    release(updated);
+                }
+                throw;
+            }
+        }
+        target->replace(slot, updated);
+        return target;
+    }
+
+    //  visit(leaf)      O(N)
+    template <typename Visitor>
+    static void for_each_leaf(const Node* node, Visitor&& visit)
+    {
+        if (!node)
+        {
+            return;
+        }
+        if (node->height == 0)
+        {
+            visit(static_cast<const Leaf*>(node));
+            return;
+        }
+        const Branch* branch = static_cast<const Branch*>(node);
+        for (size_t i = 0; i < branch->count; ++i)
+        {
+            for_each_leaf(branch->children[i], visit);
+        }
+    }
+
+    //    index       O(log N)
+    const Leaf* find_leaf(size_t index, size_t& leaf_first) const noexcept
+    {
+        if (index >= tree_size)
+        {
+            leaf_first = tree_size;
+            return tail;
+        }
+
+        const Node* node = root;
+        leaf_first = 0;
+        while (node->height > 0)
+        {
+            const Branch* branch = static_cast<const Branch*>(node);
+            size_t slot = branch->find_slot(index);
+            if (slot > 0)
+            {
+                index -= branch->sizes[slot - 1];
+                leaf_first += branch->sizes[slot - 1];
+            }
+            node = branch->children[slot];
+        }
+        return static_cast<const Leaf*>(node);
+    }
+
+//--------------------------------------------------------------    ------------------------------------------------------------------------
+
+    //     . transient        ,
+    //       ,  ,  
+
+    //  value   O(1)  , O(log N)      
+    void append(const Type& value, bool transient)
+    {
+        size_t tail_count = size - tree_size;
+        if (tail_count == kBranching)
+        {
+            push_tail(transient);
+            tail_count = 0;
+        }
+
+        if (!tail)
+        {
+            tail = new Leaf;
+        }
+        else if (!is_editable(tail, transient))
+        {
+            Leaf* copy = copy_leaf(tail, 0, tail_count);
+            release(tail);
+            tail = copy;
+        }
+
+        std::construct_at(tail->items() + tail_count, value);
+        ++tail->count;
+        ++size;
+    }
+
+    //      ,    O(log N)
+    void push_tail(bool transient)
+    {
+        //      ,      
+        Leaf* leaf = tail;
+        retain(leaf);
+
+        if (!root)
+        {
+            root = new_path(1, leaf);
+        }
+        else if (Branch* pushed = push_leaf(static_cast<Branch*>(root), leaf, transient))
+        {
+            if (pushed != root)
+            {
+                release(root);
+                root = pushed;
+            }
+        }
+        else
+        {
+            //     ,   
+            Node* path = new_path(root->height, leaf);
+            Branch* grown = nullptr;
+            try
+            {
+                grown = new Branch(root->height + 1);
+            }
+            catch (...)
+            {
+                release(path);
+                throw;
+            }
+            grown->append(root);
+            grown->append(path);
+            root = grown;
+        }
+
+        tree_size += leaf->count;
+        release(std::exchange(tail, nullptr));
+    }
+
+    //       node     .  
+    //   nullptr,      ;         .
+    //       O(log N)
+    static Branch* push_leaf(Branch* node, Leaf* leaf, bool transient)
+    {
+        bool editable = is_editable(node, transient);
+
+        size_t last = node->count - 1;
+        if (node->height > 1)
+        {
+            if (Branch* pushed = push_leaf(static_cast<Branch*>(node->children[last]), leaf, editable))
+            {
+                return replace_child(node, editable, last, pushed);
+            }
+        }
+        if (node->count == kBranching)
+        {
+            return nullptr;
+        }
+
+        Node* path = new_path(node->height - 1, leaf);
+        Branch* target = node;
+        if (!editable)
+        {
+            try
+            {
+                target = copy_branch(node, 0, node->count);
+            }
+            catch (...)
+            {
+                release(path);
+                throw;
+            }
+        }
+        target->append(path);
+        return target;
+    }
+
+    //  value   index O(log N)
+    void assign(size_t index, const Type& value, bool transient)
+    {
+        if (index >= tree_size)
+        {
+            if (!is_editable(tail, transient))
+            {
+                Leaf* copy = copy_leaf(tail, 0, tail->count);
+                release(tail);
+                tail = copy;
+            }
+            tail->items()[index - tree_size] = value;
+            return;
+        }
+
+        Node* updated = assign_in(root, index, value, transient);
+        if (updated != root)
+        {
+            release(root);
+            root = updated;
+        }
+    }
+
+    //  value   index  node,    O(log N)
+    static Node* assign_in(Node* node, size_t index, const Type& value, bool transient)
+    {
+        bool editable = is_editable(node, transient);
+
+        if (node->height == 0)
+        {
+            Leaf* leaf = static_cast<Leaf*>(node);
+            if (editable)
+            {
+                leaf->items()[index] = value;
+                return leaf;
+            }
+
+            std::unique_ptr<Leaf> copy(copy_leaf(leaf, 0, leaf->count));
+            copy->items()[index] = value;
+            return copy.release();
+        }
+
+        Branch* branch = static_cast<Branch*>(node);
+        size_t slot = branch->find_slot(index);
+        size_t local = slot ? index - branch->sizes[slot - 1] : index;
+
+        Node* updated = assign_in(branch->children[slot], local, value, editable);
+        return replace_child(branch, editable, slot, updated);
+    }
+
+    //   count  O(log N)
+    void take(size_t count)
+    {
+        if (count >= tree_size)
+        {
+            size_t kept = count - tree_size;
+            if (tail && kept < tail->count)
+            {
+                Leaf* copy = kept ? copy_leaf(tail, 0, kept) : nullptr;
+                release(tail);
+                tail = copy;
+            }
+            size = count;
+            return;
+        }
+
+        release(std::exchange(tail, nullptr));
+        if (count == 0)
+        {
+            release(std::exchange(root, nullptr));
+        }
+        else
+        {
+            Node* updated = take_tree(root, count);
+            release(root);
+            root = updated;
+            collapse();
+        }
+        tree_size = count;
+        size = count;
+
+        if (root)
+        {
+            promote_last_leaf();
+        }
+    }
+
+    //    count  node, count > 0.    O(log N)
+    static Node* take_tree(Node* node, size_t count)
+    {
+        if (count == node_size(node))
+        {
+            retain(node);
+            return node;
+        }
+        if (node->height == 0)
+        {
+            return copy_leaf(static_cast<Leaf*>(node), 0, count);
+        }
+
+        Branch* branch = static_cast<Branch*>(node);
+        size_t slot = branch->find_slot(count - 1);
+        size_t local = slot ? count - branch->sizes[slot - 1] : count;
+        if (local == node_size(branch->children[slot]))
+        {
+            return copy_branch(branch, 0, slot + 1);
+        }
+
+        Node* child = take_tree(branch->children[slot], local);
+        Branch* target = nullptr;
+        try
+        {
+            target = copy_branch(branch, 0, slot + 1);
+        }
+        catch (...)
+        {
+            release(child);
+            throw;
+        }
+        target->replace(slot, child);
+        return target;
+    }
+
+    //   count  O(log N)
+    void drop(size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        if (count >= tree_size)
+        {
+            size_t skipped = count - tree_size;
+            if (tail && skipped > 0)
+            {
+                Leaf* copy = skipped < tail->count ? copy_leaf(tail, skipped, tail->count) : nullptr;
+                release(tail);
+                tail = copy;
+            }
+            release(std::exchange(root, nullptr));
+            tree_size = 0;
+            size -= count;
+            return;
+        }
+
+        Node* updated = drop_tree(root, count);
+        release(root);
+        root = updated;
+        collapse();
+
+        tree_size -= count;
+        size -= count;
+    }
+
+    //  node   count , count   node.    O(log N)
+    static Node* drop_tree(Node* node, size_t count)
+    {
+        if (count == 0)
+        {
+            retain(node);
+            return node;
+        }
+        if (node->height == 0)
+        {
+            return copy_leaf(static_cast<Leaf*>(node), count, node->count);
+        }
+
+        Branch* branch = static_cast<Branch*>(node);
+        size_t slot = branch->find_slot(count);
+        size_t local = slot ? count - branch->sizes[slot - 1] : count;
+        if (local == 0)
+        {
+            return copy_branch(branch, slot, branch->count);
+        }
+
+        Node* child = drop_tree(branch->children[slot], local);
+        Branch* target = nullptr;
+        try
+        {
+            target = copy_branch(branch, slot, branch->count);
+        }
+        catch (...)
+        {
+            release(child);
+            throw;
+        }
+        target->replace(0, child);
+        return target;
+    }
+
+    //     ,     O(log N)
+    void collapse() noexcept
+    {
+        while (root && root->height > 1 && root->count == 1)
+        {
+            Node* child = static_cast<Branch*>(root)->children[0];
+            retain(child);
+            release(root);
+            root = child;
+        }
+    }
+
+    //       ,   push_back    O(log N)
+    void promote_last_leaf()
+    {
+        assert(!tail);
+
+        Node* node = root;
+        while (node->height > 0)
+        {
+            const Branch* branch = static_cast<const Branch*>(node);
+            node = branch->children[branch->count - 1];
+        }
+
+        Leaf* leaf = static_cast<Leaf*>(node);
+        size_t remaining = tree_size - leaf->count;
+        if (remaining == 0)
+        {
+            retain(leaf);
+            release(root);
+            root = nullptr;
+        }
+        else
+        {
+            Node* updated = take_tree(root, remaining);
+            retain(leaf);
+            release(root);
+            root = updated;
+            collapse();
+        }
+        tail = leaf;
+        tree_size = remaining;
+    }
+
+//---------------------------------------------------------------------  ----------------------------------------------------------------------------
+
+    //   left  right  .        ,   
+    //  (top) -   ,      .      O(log N)
+    static Branch* concat_subtree(Node* left, Node* right, bool top)
+    {
+        if (left->height > right->height)
+        {
+            Branch* left_branch = static_cast<Branch*>(left);
+            Branch* middle = concat_subtree(left_branch->children[left_branch->count - 1], right, false);
+            return rebalance(left_branch, middle, nullptr, top);
+        }
+        if (left->height < right->height)
+        {
+            Branch* right_branch = static_cast<Branch*>(right);
+            Branch* middle = concat_subtree(left, right_branch->children[0], false);
+            return rebalance(nullptr, middle, right_branch, top);
+        }
+
+        if (left->height == 0)
+        {
+            Leaf* left_leaf = static_cast<Leaf*>(left);
+            Leaf* right_leaf = static_cast<Leaf*>(right);
+
+            std::unique_ptr<Branch> parent(new Branch(1));
+            if (top && left_leaf->count + right_leaf->count <= kBranching)
+            {
+                std::unique_ptr<Leaf> merged(copy_leaf(left_leaf, 0, left_leaf->count));
+                for (size_t i = 0; i < right_leaf->count; ++i)
+                {
+                    std::construct_at(merged->items() + merged->count, right_leaf->items()[i]);
+                    ++merged->count;
+                }
+                parent->append(merged.release());
+            }
+            else
+            {
+                retain(left_leaf);
+                parent->append(left_leaf);
+                retain(right_leaf);
+                parent->append(right_leaf);
+            }
+            return parent.release();
+        }
+
+        Branch* left_branch = static_cast<Branch*>(left);
+        Branch* right_branch = static_cast<Branch*>(right);
+        Branch* middle = concat_subtree(left_branch->children[left_branch->count - 1], right_branch->children[0], false);
+        return rebalance(left_branch, middle, right_branch, top);
+    }
+
+    //   left ( ), middle  right ( )    ,
+    //         kExtraNodes.   middle O(K^2)
+    static Branch* rebalance(Branch* left, Branch* middle, Branch* right, bool top)
+    {
+        std::unique_ptr<Branch, void (*)(Branch*)> middle_owner(middle, [](Branch* node) { release(node); });
+
+        Node* all[2 * kBranching];
+        size_t all_count = 0;
+        if (left)
+        {
+            for (size_t i = 0; i + 1 < left->count; ++i)
+            {
+                all[all_count++] = left->children[i];
+            }
+        }
+        for (size_t i = 0; i < middle->count; ++i)
+        {
+            all[all_count++] = middle->children[i];
+        }
+        if (right)
+        {
+            for (size_t i = 1; i < right->count; ++i)
+            {
+                all[all_count++] = right->children[i];
+            }
+        }
+
+        size_t plan[2 * kBranching];
+        size_t plan_count = concat_plan(all, all_count, plan);
+
+        //        kBranching,   
+        size_t height = middle->height;
+        std::unique_ptr<Branch> first(new Branch(height));
+        std::unique_ptr<Branch> second(new Branch(height));
+
+        size_t source = 0;
+        size_t offset = 0;
+        for (size_t i = 0; i < plan_count; ++i)
+        {
+            Node* node = execute_plan_step(all, source, offset, plan[i]);
+            (i < kBranching ? first : second)->append(node);
+        }
+
+        if (plan_count <= kBranching && top)
+        {
+            return first.release();
+        }
+
+        Branch* parent = new Branch(height + 1);
+        parent->append(first.release());
+        if (plan_count > kBranching)
+        {
+            parent->append(second.release());
+        }
+        return parent;
+    }
+
+    //  :     .   ,  ,  
+    //     ,   O(K^2)
+    static size_t concat_plan(Node* const* all, size_t all_count, size_t* counts) noexcept
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < all_count; ++i)
+        {
+            counts[i] = slots(all[i]);
+            total += counts[i];
+        }
+
+        size_t optimal = (total + kBranching - 1) / kBranching;
+        size_t count = all_count;
+        size_t i = 0;
+        while (optimal + kExtraNodes < count)
+        {
+            while (counts[i] > kBranching - kExtraNodes / 2)
+            {
+                ++i;
+            }
+
+            size_t remaining = counts[i];
+            while (remaining > 0)
+            {
+                size_t merged = std::min(remaining + counts[i + 1], kBranching);
+                counts[i] = merged;
+                remaining = remaining + counts[i + 1] - merged;
+                ++i;
+            }
+            for (size_t j = i; j + 1 < count; ++j)
+            {
+                counts[j] = counts[j + 1];
+            }
+            --count;
+            --i;
+        }
+        return count;
+    }
+
+    //    slot_count ,    offset  all[source]. ,  
+    // ,     O(K)
+    static Node* execute_plan_step(Node* const* all, size_t& source, size_t& offset, size_t slot_count)
+    {
+        if (offset == 0 && slots(all[source]) == slot_count)
+        {
+            retain(all[source]);
+            return all[source++];
+        }
+
+        if (all[source]->height == 0)
+        {
+            std::unique_ptr<Leaf> leaf(new Leaf);
+            while (leaf->count < slot_count)
+            {
+                const Leaf* from = static_cast<const Leaf*>(all[source]);
+                std::construct_at(leaf->items() + leaf->count, from->items()[offset]);
+                ++leaf->count;
+                if (++offset == from->count)
+                {
+                    ++source;
+                    offset = 0;
+                }
+            }
+            return leaf.release();
+        }
+
+        std::unique_ptr<Branch> branch(new Branch(all[source]->height));
+        while (branch->count < slot_count)
+        {
+            const Branch* from = static_cast<const Branch*>(all[source]);
+            retain(from->children[offset]);
+            branch->append(from->children[offset]);
+            if (++offset == from->count)
+            {
+                ++source;
+                offset = 0;
+            }
+        }
+        return branch.release();
+    }
+
+public:
+
+    //   ,   :   O(1)  
+    class ConstIterator
+    {
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIterator() noexcept = default;
+
+        ConstIterator(const PersistentSimpleVector* vector, size_t index) noexcept : vector(vector), index(index){}
+
+        reference operator*() const noexcept
+        {
+            if (index < leaf_first || index >= leaf_last)
+            {
+                const Leaf* leaf = vector->find_leaf(index, leaf_first);
+                items = leaf->items();
+                leaf_last = leaf_first + leaf->count;
+            }
+            return items[index - leaf_first];
+        }
+
+        pointer operator->() const noexcept
+        {
+            return &**this;
+        }
+
+        reference operator[](difference_type offset) const noexcept
+        {
+            return *(*this + offset);
+        }
+
+        ConstIterator& operator++() noexcept
+        {
+            ++index;
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept
+        {
+            ConstIterator previous = *this;
+            ++index;
+            return previous;
+        }
+
+        ConstIterator& operator--() noexcept
+        {
+            --index;
+            return *this;
+        }
+
+        ConstIterator operator--(int) noexcept
+        {
+            ConstIterator previous = *this;
+            --index;
+            return previous;
+        }
+
+        ConstIterator& operator+=(difference_type offset) noexcept
+        {
+            index += offset;
+            return *this;
+        }
+
+        ConstIterator& operator-=(difference_type offset) noexcept
+        {
+            index -= offset;
+            return *this;
+        }
+
+        friend ConstIterator operator+(ConstIterator it, difference_type offset) noexcept
+        {
+            return it += offset;
+        }
+
+        friend ConstIterator operator+(difference_type offset, ConstIterator it) noexcept
+        {
+            return it += offset;
+        }
+
+        friend ConstIterator operator-(ConstIterator it, difference_type offset) noexcept
+        {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const ConstIterator& lhs, const ConstIterator& rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.index - rhs.index);
+        }
+
+        friend bool operator==(const ConstIterator& lhs, const ConstIterator& rhs) noexcept
+        {
+            return lhs.index == rhs.index;
+        }
+
+        friend std::strong_ordering operator<=>(const ConstIterator& lhs, const ConstIterator& rhs) noexcept
+        {
+            return lhs.index <=> rhs.index;
+        }
+
+    private:
+
+        const PersistentSimpleVector* vector = nullptr;
+        size_t index = 0;
+
+        //   :  [leaf_first, leaf_last)   items
+        mutable const Type* items = nullptr;
+        mutable size_t leaf_first = 0;
+        mutable size_t leaf_last = 0;
+    };
+};
+
+//======================================================================  =======================================================================
+
+//   :      ,    ,
+//  push_back O(1)     . persistent()  ,  ,
+//         
+template <typename Type>
+class TransientSimpleVector
+{
+public:
+
+    TransientSimpleVector() noexcept = default;
+
+    //    from,         O(1)
+    explicit TransientSimpleVector(const PersistentSimpleVector<Type>& from) noexcept : items(from){}
+
+    //    O(1)  
+    void push_back(const Type& value)
+    {
+        items.append(value, true);
+    }
+
+    //  value   index O(log N)
+    void set(size_t index, const Type& value)
+    {
+        if (index >= items.get_size())
+        {
+            throw std::out_of_range("Out of range");
+        }
+        items.assign(index, value, true);
+    }
+
+    //     other   O(M + log N)
+    void append(const PersistentSimpleVector<Type>& other)
+    {
+        items = items.concat(other);
+    }
+
+    //      O(log N)
+    const Type& operator[](size_t index) const noexcept
+    {
+        return items[index];
+    }
+
+    //   O(1)
+    size_t get_size() const noexcept
+    {
+        return items.get_size();
+    }
+
+    //    ,    O(1)
+    PersistentSimpleVector<Type> persistent() const noexcept
+    {
+        return items;
+    }
+
+    //    ,     O(N)
+    SimpleVector<Type> to_simple_vector() const
+    {
+        return items.to_simple_vector();
+    }
+
+private:
+
+    PersistentSimpleVector<Type> items;
+};
+
+//=================================================    =========================================================
+
+template <typename Type>
+inline bool operator==(const PersistentSimpleVector<Type>& lhs, const PersistentSimpleVector<Type>& rhs)
+{
+    return lhs.get_size() == rhs.get_size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type>
+inline bool operator!=(const PersistentSimpleVector<Type>& lhs, const PersistentSimpleVector<Type>& rhs)
+{
+    return !(lhs == rhs);
+}
@@ -0,0 +1,491 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SIMPLE_VECTOR_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMPLE_VECTOR_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SIMPLE_VECTOR_TARGET_AVX2
+#endif
+
+//  ,   ,      .
+//      : NaN  -0.0   
+template <typename Type>
+concept SimdInteger = std::is_integral_v<Type> && (sizeof(Type) == 1 || sizeof(Type) == 2 || sizeof(Type) == 4 || sizeof(Type) == 8);
+
+namespace simd_detail
+{
+#if defined(SIMPLE_VECTOR_SIMD_X86)
+
+    //     AVX2,   
+    inline bool has_avx2() noexcept
+    {
+        static const bool result = []
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+            {
+                return false;
+            }
+            __cpuid(info, 1);
+            bool os_saves_ymm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+            __cpuidex(info, 7, 0);
+            return os_saves_ymm && (info[1] & (1 << 5)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+#endif
+        }();
+        return result;
+    }
+
+//------------------------------------------------------------------------- SSE2 -----------------------------------------------------------------------
+
+    //  128-   value
+    template <typename Type>
+    __m128i broadcast_sse2(Type value) noexcept
+    {
+        if constexpr (sizeof(Type) == 1)
+        {
+            return _mm_set1_epi8(static_cast<char>(value));
+        }
+        else if constexpr (sizeof(Type) == 2)
+        {
+            return _mm_set1_epi16(static_cast<short>(value));
+        }
+        else if constexpr (sizeof(Type) == 4)
+        {
+            return _mm_set1_epi32(static_cast<int>(value));
+        }
+        else
+        {
+            return _mm_set1_epi64x(static_cast<long long>(value));
+        }
+    }
+
+    //    ,      
+    template <typename Type>
+    __m128i equal_sse2(__m128i lhs, __m128i rhs) noexcept
+    {
+        if constexpr (sizeof(Type) == 1)
+        {
+            return _mm_cmpeq_epi8(lhs, rhs);
+        }
+        else if constexpr (sizeof(Type) == 2)
+        {
+            return _mm_cmpeq_epi16(lhs, rhs);
+        }
+        else if constexpr (sizeof(Type) == 4)
+        {
+            return _mm_cmpeq_epi32(lhs, rhs);
+        }
+        else
+        {
+            //  SSE2   64- :  32-   
+            __m128i halves = _mm_cmpeq_epi32(lhs, rhs);
+            return _mm_and_si128(halves, _mm_shuffle_epi32(halves, 0xB1));
+        }
+    }
+
+    //  ,  value O(N)
+    template <typename Type>
+    const Type* find_sse2(const Type* first, const Type* last, Type value) noexcept
+    {
+        constexpr ptrdiff_t kLanes = 16 / sizeof(Type);
+        const __m128i needle = broadcast_sse2(value);
+
+        for (; last - first >= kLanes; first += kLanes)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(equal_sse2<Type>(block, needle)));
+            if (mask != 0)
+            {
+                return first + std::countr_zero(mask) / sizeof(Type);
+            }
+        }
+        return std::find(first, last, value);
+    }
+
+    //  ,  value O(N)
+    template <typename Type>
+    size_t count_sse2(const Type* first, const Type* last, Type value) noexcept
+    {
+        constexpr ptrdiff_t kLanes = 16 / sizeof(Type);
+        const __m128i needle = broadcast_sse2(value);
+        size_t matched_bytes = 0;
+
+        for (; last - first >= kLanes; first += kLanes)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            matched_bytes += std::popcount(static_cast<unsigned>(_mm_movemask_epi8(equal_sse2<Type>(block, needle))));
+        }
+        return matched_bytes / sizeof(Type) + static_cast<size_t>(std::count(first, last, value));
+    }
+
+    //      size O(N)
+    inline size_t mismatch_sse2(const unsigned char* lhs, const unsigned char* rhs, size_t size) noexcept
+    {
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) ^ 0xFFFFu;
+            if (mask != 0)
+            {
+                return i + std::countr_zero(mask);
+            }
+        }
+        for (; i < size && lhs[i] == rhs[i]; ++i)
+        {
+        }
+        return i;
+    }
+
+//------------------------------------------------------------------------- AVX2 -----------------------------------------------------------------------
+
+    //  256-   value
+    template <typename Type>
+    SIMPLE_VECTOR_TARGET_AVX2 __m256i broadcast_avx2(Type value) noexcept
+    {
+        if constexpr (sizeof(Type) == 1)
+        {
+            return _mm256_set1_epi8(static_cast<char>(value));
+        }
+        else if constexpr (sizeof(Type) == 2)
+        {
+            return _mm256_set1_epi16(static_cast<short>(value));
+        }
+        else if constexpr (sizeof(Type) == 4)
+        {
+            return _mm256_set1_epi32(static_cast<int>(value));
+        }
+        else
+        {
+            return _mm256_set1_epi64x(static_cast<long long>(value));
+        }
+    }
+
+    //    
+    template <typename Type>
+    SIMPLE_VECTOR_TARGET_AVX2 __m256i equal_avx2(__m256i lhs, __m256i rhs) noexcept
+    {
+        if constexpr (sizeof(Type) == 1)
+        {
+            return _mm256_cmpeq_epi8(lhs, rhs);
+        }
+        else if constexpr (sizeof(Type) == 2)
+        {
+            return _mm256_cmpeq_epi16(lhs, rhs);
+        }
+        else if constexpr (sizeof(Type) == 4)
+        {
+            return _mm256_cmpeq_epi32(lhs, rhs);
+        }
+        else
+        {
+            return _mm256_cmpeq_epi64(lhs, rhs);
+        }
+    }
+
+    //  ,  value O(N)
+    template <typename Type>
+    SIMPLE_VECTOR_TARGET_AVX2 const Type* find_avx2(const Type* first, const Type* last, Type value) noexcept
+    {
+        constexpr ptrdiff_t kLanes = 32 / sizeof(Type);
+        const __m256i needle = broadcast_avx2(value);
+
+        for (; last - first >= kLanes; first += kLanes)
+        {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(equal_avx2<Type>(block, needle)));
+            if (mask != 0)
+            {
+                return first + std::countr_zero(mask) / sizeof(Type);
+            }
+        }
+        return find_sse2(first, last, value);
+    }
+
+    //  ,  value O(N)
+    template <typename Type>
+    SIMPLE_VECTOR_TARGET_AVX2 size_t count_avx2(const Type* first, const Type* last, Type value) noexcept
+    {
+        constexpr ptrdiff_t kLanes = 32 / sizeof(Type);
+        const __m256i needle = broadcast_avx2(value);
+        size_t matched_bytes = 0;
+
+        for (; last - first >= kLanes; first += kLanes)
+        {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            matched_bytes += std::popcount(static_cast<unsigned>(_mm256_movemask_epi8(equal_avx2<Type>(block, needle))));
+        }
+        return matched_bytes / sizeof(Type) + count_sse2(first, last, value);
+    }
+
+    //      size O(N)
+    SIMPLE_VECTOR_TARGET_AVX2 inline size_t mismatch_avx2(const unsigned char* lhs, const unsigned char* rhs, size_t size) noexcept
+    {
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32)
+        {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+            unsigned mask = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+            if (mask != 0)
+            {
+                return i + std::countr_zero(mask);
+            }
+        }
+        return i + mismatch_sse2(lhs + i, rhs + i, size - i);
+    }
+
+    //   (IsMax == false)  ,  8-   AVX2  
+    template <typename Type, bool IsMax>
+    SIMPLE_VECTOR_TARGET_AVX2 __m256i select_avx2(__m256i lhs, __m256i rhs) noexcept
+    {
+        constexpr bool kSigned = std::is_signed_v<Type>;
+
+        if constexpr (sizeof(Type) == 1)
+        {
+            return IsMax ? (kSigned ? _mm256_max_epi8(lhs, rhs) : _mm256_max_epu8(lhs, rhs))
+                         : (kSigned ? _mm256_min_epi8(lhs, rhs) : _mm256_min_epu8(lhs, rhs));
+        }
+        else if constexpr (sizeof(Type) == 2)
+        {
+            return IsMax ? (kSigned ? _mm256_max_epi16(lhs, rhs) : _mm256_max_epu16(lhs, rhs))
+                         : (kSigned ? _mm256_min_epi16(lhs, rhs) : _mm256_min_epu16(lhs, rhs));
+        }
+        else
+        {
+            static_assert(sizeof(Type) == 4);
+            return IsMax ? (kSigned ? _mm256_max_epi32(lhs, rhs) : _mm256_max_epu32(lhs, rhs))
+                         : (kSigned ? _mm256_min_epi32(lhs, rhs) : _mm256_min_epu32(lhs, rhs));
+        }
+    }
+
+    //       O(N)
+    template <typename Type, bool IsMax>
+    SIMPLE_VECTOR_TARGET_AVX2 Type extreme_avx2(const Type* first, const Type* last) noexcept
+    {
+        constexpr ptrdiff_t kLanes = 32 / sizeof(Type);
+        auto pick = [](Type lhs, Type rhs) { return IsMax ? std::max(lhs, rhs) : std::min(lhs, rhs); };
+
+        Type result = *first;
+        if (last - first >= kLanes)
+        {
+            __m256i accumulator = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            for (first += kLanes; last - first >= kLanes; first += kLanes)
+            {
+                accumulator = select_avx2<Type, IsMax>(accumulator, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)));
+            }
+
+            alignas(32) Type lanes[kLanes];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), accumulator);
+            for (Type lane : lanes)
+            {
+                result = pick(result, lane);
+            }
+        }
+        for (; first != last; ++first)
+        {
+            result = pick(result, *first);
+        }
+        return result;
+    }
+
+#endif
+}
+
+//=================================================        ======================================
+
+//   [first, last),  value,  last O(N)
+template <typename Type>
+const Type* simd_find(const Type* first, const Type* last, const std::type_identity_t<Type>& value)
+{
+#if defined(SIMPLE_VECTOR_SIMD_X86)
+    if constexpr (SimdInteger<Type>)
+    {
+        return simd_detail::has_avx2() ? simd_detail::find_avx2(first, last, value) : simd_detail::find_sse2(first, last, value);
+    }
+#endif
+    return std::find(first, last, value);
+}
+
+//   [first, last),  value O(N)
+template <typename Type>
+size_t simd_count(const Type* first, const Type* last, const std::type_identity_t<Type>& value)
+{
+#if defined(SIMPLE_VECTOR_SIMD_X86)
+    if constexpr (SimdInteger<Type>)
+    {
+        return simd_detail::has_avx2() ? simd_detail::count_avx2(first, last, value) : simd_detail::count_sse2(first, last, value);
+    }
+#endif
+    return static_cast<size_t>(std::count(first, last, value));
+}
+
+//       last    O(N)
+template <typename Type>
+const Type* simd_min_element(const Type* first, const Type* last)
+{
+#if defined(SIMPLE_VECTOR_SIMD_X86)
+    if constexpr (SimdInteger<Type> && sizeof(Type) <= 4)
+    {
+        if (first != last && simd_detail::has_avx2())
+        {
+            return simd_find(first, last, simd_detail::extreme_avx2<Type, false>(first, last));
+        }
+    }
+#endif
+    return std::min_element(first, last);
+}
+
+//       last    O(N)
+template <typename Type>
+const Type* simd_max_element(const Type* first, const Type* last)
+{
+#if defined(SIMPLE_VECTOR_SIMD_X86)
+    if constexpr (SimdInteger<Type> && sizeof(Type) <= 4)
+    {
+        if (first != last && simd_detail::has_avx2())
+        {
+            return simd_find(first, last, simd_detail::extreme_avx2<Type, true>(first, last));
+        }
+    }
+#endif
+    return std::max_element(first, last);
+}
+
+//  ,       O(N)
+template <typename Type>
+bool simd_equal(const Type* first1, const Type* last1, const Type* first2, const Type* last2)
+{
+    if constexpr (SimdInteger<Type>)
+    {
+        size_t size = static_cast<size_t>(last1 - first1);
+        return size == static_cast<size_t>(last2 - first2) && (size == 0 || std::memcmp(first1, first2, size * sizeof(Type)) == 0);
+    }
+    else
+    {
+        return std::equal(first1, last1, first2, last2);
+    }
+}
+
+//  :    ,     O(N)
+template <typename Type>
+bool simd_lexicographical_compare(const Type* first1, const Type* last1, const Type* first2, const Type* last2)
+{
+#if defined(SIMPLE_VECTOR_SIMD_X86)
+    if constexpr (SimdInteger<Type>)
+    {
+        size_t size1 = static_cast<size_t>(last1 - first1);
+        size_t size2 = static_cast<size_t>(last2 - first2);
+        size_t common = std::min(size1, size2);
+
+        const unsigned char* lhs = reinterpret_cast<const unsigned char*>(first1);
+        const unsigned char* rhs = reinterpret_cast<const unsigned char*>(first2);
+        size_t byte = simd_detail::has_avx2() ? simd_detail::mismatch_avx2(lhs, rhs, common * sizeof(Type))
+                                              : simd_detail::mismatch_sse2(lhs, rhs, common * sizeof(Type));
+        size_t index = byte / sizeof(Type);
+
+        return index < common ? first1[index] < first2[index] : size1 < size2;
+    }
+#endif
+    return std::lexicographical_compare(first1, last1, first2, last2);
+}
+
+//---------------------------------------------------------------    -----------------------------------------------------------------
+
+namespace simd_detail
+{
+    //  value       Type     .
+    //       :   ,  std::cmp_equal,
+    //       std::find,  -1  UINT_MAX
+    template <typename Type, typename Value>
+    constexpr bool is_representable(const Value& value) noexcept
+    {
+        if constexpr (std::is_integral_v<Type> && std::is_integral_v<Value>)
+        {
+            Type converted = static_cast<Type>(value);
+            if (static_cast<Value>(converted) != value)
+            {
+                return false;
+            }
+            if constexpr (std::is_signed_v<Value> && !std::is_signed_v<Type>)
+            {
+                return value >= 0;
+            }
+            if constexpr (!std::is_signed_v<Value> && std::is_signed_v<Type>)
+            {
+                return converted >= 0;
+            }
+        }
+        return true;
+    }
+}
+
+//   ,  value,  end(). value     ,   O(N)
+template <typename Container, typename Value>
+auto simd_find(const Container& container, const Value& value)
+{
+    using Type = std::remove_cvref_t<decltype(*container.data())>;
+
+    const Type* first = container.data();
+    const Type* last = first + container.get_size();
+    if constexpr (std::is_integral_v<Type> && std::is_integral_v<Value>)
+    {
+        return simd_detail::is_representable<Type>(value) ? simd_find(first, last, static_cast<Type>(value)) : last;
+    }
+    else
+    {
+        return simd_find(first, last, value);
+    }
+}
+
+//   ,  value. value      O(N)
+template <typename Container, typename Value>
+size_t simd_count(const Container& container, const Value& value)
+{
+    using Type = std::remove_cvref_t<decltype(*container.data())>;
+
+    const Type* first = container.data();
+    const Type* last = first + container.get_size();
+    if constexpr (std::is_integral_v<Type> && std::is_integral_v<Value>)
+    {
+        return simd_detail::is_representable<Type>(value) ? simd_count(first, last, static_cast<Type>(value)) : 0;
+    }
+    else
+    {
+        return simd_count(first, last, value);
+    }
+}
+
+//     O(N)
+template <typename Container>
+auto simd_min_element(const Container& container)
+{
+    return simd_min_element(container.data(), container.data() + container.get_size());
+}
+
+//     O(N)
+template <typename Container>
+auto simd_max_element(const Container& container)
+{
+    return simd_max_element(container.data(), container.data() + container.get_size());
+}
@@ -1,10 +1,18 @@
 #pragma once
 
 #include "array_ptr.h"
+#include "growth_policy.h"
+#include "simd_algorithms.h"
 
 #include <iostream>
+#include <algorithm>
 #include <cassert>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
 #include <stdexcept>
 
 //       reserve
@@ -24,49 +32,84 @@ private:
     size_t capacity;
 };
 
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DoublingGrowth>
 class SimpleVector 
 {
 public:
 
     using Iterator = Type*;
     using ConstIterator = const Type*;
+    using allocator_type = Allocator;
 
 //=====================================================================    ==========================================================
 
     SimpleVector() noexcept = default;
 
+    //      
+    explicit SimpleVector(const Allocator& alloc) noexcept : items(alloc){}
+
     //      
-    explicit SimpleVector(size_t size) : SimpleVector(size, Type()){}
+    explicit SimpleVector(size_t size, const Allocator& alloc = Allocator()) : items(size, alloc), size(size), capacity(size)
+    {
+        items.uninitialized_value_construct(items.get(), size);
+    }
 
     //     
-    SimpleVector(size_t size, const Type& value) : items(size), size(size), capacity(size)
+    SimpleVector(size_t size, const Type& value, const Allocator& alloc = Allocator()) : items(size, alloc), size(size), capacity(size)
     {
-        std::fill(items.get(), items.get() + size, value);
+        items.uninitialized_fill(items.get(), size, value);
     }
 
     //     {}
-    SimpleVector(std::initializer_list<Type> init) : items(init.size()), size(init.size()), capacity(init.size())
+    SimpleVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator())
+        : items(init.size(), alloc), size(init.size()), capacity(init.size())
     {
-        std::copy(init.begin(), init.end(), items.get());
+        items.uninitialized_copy(init.begin(), init.end(), items.get());
     }
 
     //    
-    explicit SimpleVector(ReserveProxyObj obj)
+    explicit SimpleVector(ReserveProxyObj obj, const Allocator& alloc = Allocator()) : items(alloc)
     {
         reserve(obj.get_capacity());
     }
 
     //   O(N)
-    SimpleVector(const SimpleVector& other) : items(new Type[other.size]), size(other.size)
+    SimpleVector(const SimpleVector& other)
+        : SimpleVector(other, AllocTraits::select_on_container_copy_construction(other.get_allocator())){}
+
+    //      O(N)
+    SimpleVector(const SimpleVector& other, const Allocator& alloc) : items(other.size, alloc), size(other.size), capacity(other.size)
     {
-        std::copy(other.begin(), other.end(), items.get());
+        items.uninitialized_copy(other.begin(), other.end(), items.get());
     }
 
     //  
     SimpleVector(SimpleVector&& other) noexcept
+        : items(std::move(other.items)), size(std::exchange(other.size, 0)), capacity(std::exchange(other.capacity, 0)){}
+
+    //     ,      O(N)
+    SimpleVector(SimpleVector&& other, const Allocator& alloc) : items(alloc)
     {
-        swap(other);
+        if (alloc == other.get_allocator())
+        {
+            swap(other);
+        }
+        else
+        {
+            ArrayPtr<Type, Allocator> temp = allocate(other.size);
+            temp.uninitialized_move(other.begin(), other.end(), temp.get());
+
+            items.swap(temp);
+            size = other.size;
+            capacity = other.size;
+        }
+    }
+
+    //   ,   ArrayPtr O(N)
+    ~SimpleVector()
+    {
+        VectorStats<Type>::released(capacity, size);
+        items.destroy(items.get(), items.get() + size);
     }
 
 //================================================================  ===============================================================================
@@ -90,8 +133,38 @@ public:
     {
         if (this != &rhs)
         {
-            SimpleVector temp(rhs);
-            swap(temp);
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+            {
+                *this = SimpleVector(rhs, rhs.get_allocator());
+            }
+            else
+            {
+                SimpleVector temp(rhs, get_allocator());
+                swap(temp);
+            }
+        }
+        return *this;
+    }
+
+    //   , O(1)   ,  O(N)
+    SimpleVector& operator=(SimpleVector&& rhs)
+        noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+    {
+        if (this != &rhs)
+        {
+            if (AllocTraits::propagate_on_container_move_assignment::value || get_allocator() == rhs.get_allocator())
+            {
+                VectorStats<Type>::released(capacity, size);
+                clear();
+                items = std::move(rhs.items);
+                size = std::exchange(rhs.size, 0);
+                capacity = std::exchange(rhs.capacity, 0);
+            }
+            else
+            {
+                SimpleVector temp(std::move(rhs), get_allocator());
+                swap(temp);
+            }
         }
         return *this;
     }
@@ -140,124 +213,273 @@ public:
     //      O(N)
     void push_back(const Type& item)
     {
-        if (size + 1 > capacity)
-        {
-            size_t new_capacity = std::max(size + 1, capacity * 2);
-            ArrayPtr<Type> temp(new_capacity);
+        emplace_back(item);
+    }
 
-            std::copy(items.get(), items.get() + size, temp.get());
+    //      O(N)
+    void push_back(Type&& item)
+    {
+        emplace_back(std::move(item));
+    }
 
-            items.swap(temp);
-            capacity = new_capacity;
+    //          O(N)
+    template <typename... Args>
+    Type& emplace_back(Args&&... args)
+    {
+        //   size + 1:   GCC  -O2       -Wstringop-overflow
+        if (size == capacity)
+        {
+            size_t new_capacity = grow_capacity(size + 1);
+
+            if constexpr (ArrayPtr<Type, Allocator>::can_reallocate)
+            {
+                //     ,  realloc   
+                Type temp(std::forward<Args>(args)...);
+
+                reallocate(new_capacity);
+                items.construct(items.get() + size, std::move(temp));
+            }
+            else
+            {
+                ArrayPtr<Type, Allocator> temp = allocate(new_capacity);
+
+                //      :     
+                temp.construct(temp.get() + size, std::forward<Args>(args)...);
+                relocate_around(temp, size);
+            }
+        }
+        else
+        {
+            items.construct(items.get() + size, std::forward<Args>(args)...);
         }
-
-        items[size] = item;
         ++size;
+
+        return items[size - 1];
     }
 
-    //      O(N)
-    void push_back(Type&& item)
+    //    ,        .  
+    //  .       ,      O(N)
+    template <std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+    void append_range(InputIterator first, Sentinel last)
     {
-        if (size + 1 > capacity)
+        if constexpr (std::forward_iterator<InputIterator> || std::sized_sentinel_for<Sentinel, InputIterator>)
         {
-            size_t new_capacity = std::max(size + 1, capacity * 2);
-            ArrayPtr<Type> temp(new_capacity);
-
-            std::move(items.get(), items.get() + size, temp.get());
-            items.swap(temp);
+            size_t range_size = static_cast<size_t>(std::ranges::distance(first, last));
+            if (size + range_size > capacity)
+            {
+                reallocate(grow_capacity(size + range_size));
+            }
+            items.uninitialized_copy(std::move(first), std::move(last), items.get() + size);
+            size += range_size;
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+    }
 
-            capacity = new_capacity;
+    //   std::ranges  ,        O(N)
+    template <std::ranges::input_range Range>
+    void append_range(Range&& range)
+    {
+        if constexpr (std::ranges::sized_range<Range> && !std::ranges::forward_range<Range>)
+        {
+            size_t range_size = static_cast<size_t>(std::ranges::size(range));
+            if (size + range_size > capacity)
+            {
+                reallocate(grow_capacity(size + range_size));
+            }
         }
-        items[size] = std::move(item);
-        ++size;
+        append_range(std::ranges::begin(range), std::ranges::end(range));
     }
 
-    //     O(N)
-    template <typename InputIterator>
-    void append_range(InputIterator first, InputIterator last)
+    //    other  , other  .     other
+    // ,       O(N)
+    void append_range(SimpleVector&& other)
     {
-        size_t range_size = std::distance(first, last);
-        if (size + range_size > capacity)
+        if (this == &other)
+        {
+            return;
+        }
+        if (size == 0 && capacity <= other.capacity && get_allocator() == other.get_allocator())
         {
-            size_t new_capacity = std::max(size + range_size, capacity * 2);
-            ArrayPtr<Type> temp(new_capacity);
+            swap(other);
+            return;
+        }
 
-            std::fill(temp.get(), temp.get() + new_capacity, Type());
-            std::copy(items.get(), items.get() + size, temp.get());
+        if (size + other.size > capacity)
+        {
+            reallocate(grow_capacity(size + other.size));
+        }
 
-            items.swap(temp);
-            capacity = new_capacity;
+        if constexpr (is_trivially_relocatable_v<Type>)
+        {
+            items.uninitialized_relocate(other.begin(), other.end(), items.get() + size);
+            size += std::exchange(other.size, 0);
+        }
+        else
+        {
+            items.uninitialized_move(other.begin(), other.end(), items.get() + size);
+            size += other.size;
+            other.clear();
         }
-        std::copy(first, last, items.get() + size);
-        size += range_size;
+    }
+
+    //  count ,  construct(first, last)     [first, last).
+    //  construct  ,        O(N)
+    template <typename Constructor>
+    void append_constructed(size_t count, Constructor construct)
+    {
+        if (size + count > capacity)
+        {
+            reallocate(grow_capacity(size + count));
+        }
+        construct(items.get() + size, items.get() + size + count);
+        size += count;
     }
 
     //     c  O(N)
     Iterator insert(ConstIterator pos, const Type& value)
+    {
+        return emplace(pos, value);
+    }
+
+    //       O(N)
+    Iterator insert(ConstIterator pos, Type&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    //     ,        .  
+    //  ,      .        O(N + K)
+    template <std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+    Iterator insert(ConstIterator pos, InputIterator first, Sentinel last)
     {
         assert(pos >= begin() && pos <= end());
 
-        size_t count = pos - items.get();
+        size_t index = pos - items.get();
 
-        if (capacity == 0)
-        {
-            ArrayPtr<Type> temp(1);
-            temp[count] = value;
-            items.swap(temp);
-            ++capacity;
-        }
-        else if (size < capacity)
+        if constexpr (std::forward_iterator<InputIterator>)
         {
-            std::copy_backward(items.get() + count, items.get() + size, items.get() + size + 1);
-            items[count] = value;
+            size_t count = static_cast<size_t>(std::ranges::distance(first, last));
+
+            if (size + count > capacity)
+            {
+                ArrayPtr<Type, Allocator> temp = allocate(grow_capacity(size + count));
+
+                temp.uninitialized_copy(std::move(first), std::move(last), temp.get() + index);
+                relocate_around(temp, index, count);
+                size += count;
+            }
+            else if (count > 0)
+            {
+                open_gap(index, count,
+                    [&](Type* dest, size_t offset, size_t created)
+                    {
+                        InputIterator from = std::ranges::next(first, offset);
+                        items.uninitialized_copy(from, std::ranges::next(from, created), dest);
+                    },
+                    [&](Type* dest, size_t assigned)
+                    {
+                        std::ranges::copy(first, std::ranges::next(first, assigned), dest);
+                    });
+            }
         }
         else
         {
-            size_t new_capacity = std::max(size + 1, capacity * 2);
-            ArrayPtr<Type> temp(new_capacity);
+            size_t old_size = size;
+            append_range(std::move(first), std::move(last));
+            std::rotate(items.get() + index, items.get() + old_size, items.get() + size);
+        }
 
-            std::copy(items.get(), items.get() + size, temp.get());
-            std::copy_backward(items.get() + count, items.get() + size, temp.get() + size + 1);
+        return items.get() + index;
+    }
 
-            temp[count] = value;
-            items.swap(temp);
-            capacity = new_capacity;
+    //  count  value   , value      O(N + K)
+    Iterator insert(ConstIterator pos, size_t count, const Type& value)
+    {
+        assert(pos >= begin() && pos <= end());
+
+        size_t index = pos - items.get();
+
+        if (size + count > capacity)
+        {
+            ArrayPtr<Type, Allocator> temp = allocate(grow_capacity(size + count));
+
+            temp.uninitialized_fill(temp.get() + index, count, value);
+            relocate_around(temp, index, count);
+            size += count;
         }
-        ++size;
-        return &items[count];
+        else if (count > 0)
+        {
+            Type copy(value);
+
+            open_gap(index, count,
+                [&](Type* dest, size_t, size_t created)
+                {
+                    items.uninitialized_fill(dest, created, copy);
+                },
+                [&](Type* dest, size_t assigned)
+                {
+                    std::fill_n(dest, assigned, copy);
+                });
+        }
+
+        return items.get() + index;
     }
 
-    //       O(N)
-    Iterator insert(Iterator pos, Type&& value)
+    //      O(N + K)
+    Iterator insert(ConstIterator pos, std::initializer_list<Type> init)
+    {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    //         O(N)
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args)
     {
         assert(pos >= begin() && pos <= end());
 
         size_t count = pos - items.get();
 
-        if (capacity == 0)
+        if (size < capacity)
         {
-            ArrayPtr<Type> temp(1);
-
-            temp[count] = std::move(value);
-            items.swap(temp);
-            ++capacity;
+            if (count == size)
+            {
+                items.construct(items.get() + size, std::forward<Args>(args)...);
+            }
+            else
+            {
+                //      ,    
+                Type temp(std::forward<Args>(args)...);
+
+                items.construct(items.get() + size, std::move(items[size - 1]));
+                //     :    GCC  -O2  
+                //      -Wstringop-overflow
+                Type* position = items.get() + count;
+                size_t shifted = size - 1 - count;
+                std::move_backward(position, position + shifted, position + shifted + 1);
+                items[count] = std::move(temp);
+                VectorStats<Type>::moved(size - count);
+            }
         }
-        else if (size < capacity)
+        else if constexpr (ArrayPtr<Type, Allocator>::can_reallocate)
         {
-            std::move_backward(items.get() + count, items.get() + size, items.get() + size + 1);
-            items[count] = std::move(value);
+            Type temp(std::forward<Args>(args)...);
+
+            reallocate(grow_capacity(size + 1));
+            return emplace(items.get() + count, std::move(temp));
         }
         else
         {
-            size_t new_capacity = std::max(size + 1, capacity * 2);
-            ArrayPtr<Type> temp(new_capacity);
-
-            std::move(items.get(), items.get() + size, temp.get());
-            std::move_backward(items.get() + count, items.get() + size, temp.get() + size + 1);
+            size_t new_capacity = grow_capacity(size + 1);
+            ArrayPtr<Type, Allocator> temp = allocate(new_capacity);
 
-            temp[count] = std::move(value);
-            items.swap(temp);
-            capacity = new_capacity;
+            temp.construct(temp.get() + count, std::forward<Args>(args)...);
+            relocate_around(temp, count);
         }
         ++size;
 
@@ -275,7 +497,7 @@ public:
     //   O(1)
     size_t max_size() const
     {
-        size_t max_size_vec = std::numeric_limits<size_t>::max / sizeof(Type);
+        size_t max_size_vec = std::numeric_limits<size_t>::max() / sizeof(Type);
         return max_size_vec;
     }
 
@@ -370,25 +592,16 @@ public:
     {
         if (new_size <= size) 
         {
+            items.destroy(items.get() + new_size, items.get() + size);
             size = new_size;
-        }
-        if (new_size <= capacity) 
-        {
-            fill(items.get() + size, items.get() + new_size);
+            return;
         }
         if (new_size > capacity) 
         {
-            size_t new_capacity = std::max(new_size, capacity * 2);
-            ArrayPtr<Type> temp(new_capacity);
-
-            fill(temp.get(), temp.get() + new_capacity);
-            std::move(items.get(), items.get() + capacity, temp.get());
-
-            items.swap(temp);
-
-            size = new_size;
-            capacity = new_capacity;
+            reallocate(grow_capacity(new_size));
         }
+        items.uninitialized_value_construct(items.get() + size, new_size - size);
+        size = new_size;
     }
 
     //     O(N)
@@ -396,12 +609,7 @@ public:
     {
         if (size < capacity)
         {
-            ArrayPtr<Type> new_items(size);
-
-            std::copy(items.get(), items.get() + size, new_items.get());
-            items.swap(new_items);
-
-            capacity = size;
+            reallocate(size);
         }
     }
 
@@ -410,12 +618,7 @@ public:
     {
         if (new_capacity > capacity)
         {
-            ArrayPtr<Type> temp(new_capacity);
-
-            std::copy(items.get(), items.get() + size, temp.get());
-
-            items.swap(temp);
-            capacity = new_capacity;
+            reallocate(new_capacity);
         }
     }
 
@@ -424,6 +627,7 @@ public:
     //   O(1)
     void clear() noexcept
     {
+        items.destroy(items.get(), items.get() + size);
         size = 0;
     }
 
@@ -433,7 +637,7 @@ public:
         assert(size > 0);
 
         --size;
-
+        items.destroy(items.get() + size, items.get() + size + 1);
     }
 
     //      O(N)
@@ -449,11 +653,69 @@ public:
         }
 
         std::move(items.get() + count + 1, items.get() + size, items.get() + count);
+        VectorStats<Type>::moved(size - count - 1);
         --size;
+        items.destroy(items.get() + size, items.get() + size + 1);
 
         return &items[count];
     }
 
+    //   [first, last),     O(N)
+    Iterator erase(ConstIterator first, ConstIterator last)
+    {
+        assert(first >= begin() && first <= last && last <= end());
+
+        Type* position = items.get() + (first - items.get());
+        Type* tail = items.get() + (last - items.get());
+
+        //  :      ,       
+        if (position == tail)
+        {
+            return position;
+        }
+
+        Type* new_end = std::move(tail, end(), position);
+        VectorStats<Type>::moved(end() - tail);
+
+        items.destroy(new_end, end());
+        size = new_end - items.get();
+
+        return position;
+    }
+
+    //     :       O(1)
+    Iterator unordered_erase(ConstIterator pos)
+    {
+        assert(pos >= begin() && pos < end());
+
+        Type* position = items.get() + (pos - items.get());
+        Type* last = items.get() + size - 1;
+
+        if (position != last)
+        {
+            *position = std::move(*last);
+            VectorStats<Type>::moved(1);
+        }
+        items.destroy(last, last + 1);
+        --size;
+
+        return position;
+    }
+
+    //   ,   predicate ,      .
+    //     O(N)
+    template <typename Predicate>
+    size_t erase_if(Predicate predicate)
+    {
+        Type* new_end = std::remove_if(begin(), end(), std::move(predicate));
+        size_t removed = end() - new_end;
+
+        items.destroy(new_end, end());
+        size -= removed;
+
+        return removed;
+    }
+
 //---------------------------------------------------------------------   ----------------------------------------------------------------------
 
     //     O(N)
@@ -461,16 +723,34 @@ public:
     {
         if (new_size > capacity)
         {
-            ArrayPtr<Type> newData(new_size);
+            ArrayPtr<Type, Allocator> newData = allocate(new_size);
+            newData.uninitialized_fill(newData.get(), new_size, value);
+
+            VectorStats<Type>::released(capacity, size);
+            items.destroy(items.get(), items.get() + size);
             items.swap(newData);
             capacity = new_size;
         }
-
-        std::fill_n(items.get(), new_size, value);
+        else if (new_size > size)
+        {
+            std::fill_n(items.get(), size, value);
+            items.uninitialized_fill(items.get() + size, new_size - size, value);
+        }
+        else
+        {
+            std::fill_n(items.get(), new_size, value);
+            items.destroy(items.get() + new_size, items.get() + size);
+        }
         size = new_size;
     }
 
-    //   O(N)
+    //   O(1)
+    Allocator get_allocator() const noexcept
+    {
+        return items.get_allocator();
+    }
+
+    //   O(1)
     void swap(SimpleVector& other) noexcept 
     {
         std::swap(capacity, other.capacity);
@@ -493,62 +773,188 @@ public:
 
 private:
 
-    ArrayPtr<Type> items;
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    ArrayPtr<Type, Allocator> items;
     size_t size = 0;
     size_t capacity = 0;
 
-    //   O(N)
-    static void fill(Iterator first, Iterator last)
+    //     required    . required    size 
+    //  size + count,    required -   :   
+    //  std::length_error,        O(1)
+    size_t grow_capacity(size_t required) const
     {
-        assert(first <= last);
+        size_t new_capacity = GrowthPolicy::next_capacity(capacity, required, sizeof(Type));
+        if (required <= size || new_capacity < required || new_capacity > max_size())
+        {
+            throw std::length_error("SimpleVector is too large");
+        }
+        return new_capacity;
+    }
+
+    //     O(1)
+    ArrayPtr<Type, Allocator> allocate(size_t count) const
+    {
+        return ArrayPtr<Type, Allocator>(count, items.get_allocator());
+    }
+
+    //    count    index   ,    .
+    //       construct(dest, offset, created),  offset -    
+    //  ,   assign(dest, assigned)   .   O(N)
+    template <typename Construct, typename Assign>
+    void open_gap(size_t index, size_t count, Construct construct, Assign assign)
+    {
+        Type* position = items.get() + index;
+        Type* old_end = items.get() + size;
+        size_t after = size - index;
+
+        if (after > count)
+        {
+            items.uninitialized_move(old_end - count, old_end, old_end);
+            size += count;
+
+            std::move_backward(position, old_end - count, old_end);
+            VectorStats<Type>::moved(after - count);
+
+            assign(position, count);
+        }
+        else
+        {
+            construct(old_end, after, count - after);
+            size += count - after;
+
+            items.uninitialized_move(position, old_end, position + count);
+            size += after;
+
+            assign(position, after);
+        }
+    }
+
+    //           O(N)
+    void relocate(ArrayPtr<Type, Allocator>& new_items)
+    {
+        record_reallocation();
+        new_items.uninitialized_relocate(items.get(), items.get() + size, new_items.get());
+
+        items.swap(new_items);
+        capacity = items.get_capacity();
+    }
+
+    //            count     position.
+    //        ,  ,  
+    //    ,        ( ) O(N)
+    void relocate_around(ArrayPtr<Type, Allocator>& new_items, size_t position, size_t count = 1)
+    {
+        Type* old_items = items.get();
+        Type* new_element = new_items.get() + position;
+        Type* new_end = new_element + count;
+
+        record_reallocation();
+
+        if constexpr (is_trivially_relocatable_v<Type>)
+        {
+            new_items.uninitialized_relocate(old_items, old_items + position, new_items.get());
+            new_items.uninitialized_relocate(old_items + position, old_items + size, new_end);
+        }
+        else
+        {
+            try
+            {
+                Type* prefix_end = new_items.uninitialized_move_if_noexcept(old_items, old_items + position, new_items.get());
+                try
+                {
+                    new_items.uninitialized_move_if_noexcept(old_items + position, old_items + size, new_end);
+                }
+                catch (...)
+                {
+                    new_items.destroy(new_items.get(), prefix_end);
+                    throw;
+                }
+            }
+            catch (...)
+            {
+                new_items.destroy(new_element, new_end);
+                throw;
+            }
+            items.destroy(old_items, old_items + size);
+        }
 
-        for (; first != last; ++first)
+        items.swap(new_items);
+        capacity = items.get_capacity();
+    }
+
+    //     :        O(1)
+    void record_reallocation() const noexcept
+    {
+        if (capacity != 0)
+        {
+            VectorStats<Type>::reallocated();
+            VectorStats<Type>::released(capacity, size);
+        }
+    }
+
+    //     : realloc  ,   ,   O(N)
+    void reallocate(size_t new_capacity)
+    {
+        if constexpr (ArrayPtr<Type, Allocator>::can_reallocate)
+        {
+            record_reallocation();
+            items.reallocate(new_capacity);
+            capacity = new_capacity;
+        }
+        else
         {
-            *first = Type(); // move
+            ArrayPtr<Type, Allocator> temp = allocate(new_capacity);
+
+            relocate(temp);
         }
     }
 };
 
 //         
-ReserveProxyObj reserve(size_t capacity_to_reserve) 
+inline ReserveProxyObj reserve(size_t capacity_to_reserve) 
 {
     return ReserveProxyObj(capacity_to_reserve);
 }
 
 //=================================================    =========================================================
 
-template <typename Type>
-inline bool operator==(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator==(const SimpleVector<Type, Allocator, GrowthPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy>& rhs)
 {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    return simd_equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename Type>
-inline bool operator!=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator!=(const SimpleVector<Type, Allocator, GrowthPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy>& rhs)
 {
     return !(lhs == rhs);
 }
 
-template <typename Type>
-inline bool operator<(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) 
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator<(const SimpleVector<Type, Allocator, GrowthPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy>& rhs) 
 {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    return simd_lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename Type>
-inline bool operator<=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) 
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator<=(const SimpleVector<Type, Allocator, GrowthPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy>& rhs) 
 {
     return !(rhs < lhs);
 }
 
-template <typename Type>
-inline bool operator>(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) 
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator>(const SimpleVector<Type, Allocator, GrowthPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy>& rhs) 
 {
     return !(lhs <= rhs);
 }
 
-template <typename Type>
-inline bool operator>=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) 
+template <typename Type, typename Allocator, typename GrowthPolicy>
+inline bool operator>=(const SimpleVector<Type, Allocator, GrowthPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy>& rhs) 
 {
     return !(lhs < rhs);
-}
\ No newline at end of file
+}
+
+// ,     std::pmr::memory_resource (, )
+template <typename Type>
+using PmrSimpleVector = SimpleVector<Type, std::pmr::polymorphic_allocator<Type>>;
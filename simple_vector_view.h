@@ -0,0 +1,266 @@
+#pragma once
+
+#include "array_ptr.h"
+#include "simd_algorithms.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+//    :   .   SimpleVector  
+//   data()  get_size(),   ArrayPtr    .  subview - O(1)
+//   .  SimpleVectorView<const Type>   
+template <typename Type>
+class SimpleVectorView
+{
+public:
+
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+//=====================================================================  =======================================================================
+
+    SimpleVectorView() noexcept = default;
+
+    //  count    items
+    SimpleVectorView(Type* items, size_t count) noexcept : items(items), size(count){}
+
+    //          ,     
+    template <typename Other>
+        requires (!std::is_convertible_v<Other(*)[], Type(*)[]>)
+    SimpleVectorView(Other* items, size_t count) = delete;
+
+    //   count   ArrayPtr
+    template <typename Allocator>
+    SimpleVectorView(const ArrayPtr<std::remove_const_t<Type>, Allocator>& array, size_t count) noexcept
+        : items(array.get()), size(count)
+    {
+        assert(count <= array.get_capacity());
+    }
+
+    //    data()  get_size(): SimpleVector, SmallSimpleVector, MappedSimpleVector,  SoAVector.
+    //   std::span,    const:      
+    //      sizeof  
+    template <typename Container>
+        requires (!std::is_same_v<std::remove_cvref_t<Container>, SimpleVectorView>
+            && requires(Container& container)
+            {
+                { container.data() } -> std::convertible_to<Type*>;
+                { container.get_size() } -> std::convertible_to<size_t>;
+            }
+            && std::is_convertible_v<std::remove_pointer_t<decltype(std::declval<Container&>().data())>(*)[], Type(*)[]>)
+    SimpleVectorView(Container& container) noexcept : items(container.data()), size(container.get_size()){}
+
+    //  std::span,   view_binary
+    SimpleVectorView(std::span<Type> span) noexcept : items(span.data()), size(span.size()){}
+
+    //    ,    
+    template <typename Other>
+        requires (!std::is_same_v<Other, Type> && std::is_convertible_v<Other(*)[], Type(*)[]>)
+    SimpleVectorView(const SimpleVectorView<Other>& other) noexcept : items(other.data()), size(other.get_size()){}
+
+//================================================================  ===============================================================================
+
+    //     O(1)
+    Type& operator[](size_t index) const noexcept
+    {
+        assert(index < size);
+        return items[index];
+    }
+
+//=====================================================================  ==========================================================================
+
+    //    O(1)
+    Iterator begin() const noexcept
+    {
+        return items;
+    }
+
+    //    O(1)
+    Iterator end() const noexcept
+    {
+        return items + size;
+    }
+
+    // O(1)
+    ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    // O(1)
+    ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+//=====================================================================  =============================================================================
+
+//--------------------------------------------------------------   ------------------------------------------------------------------------
+
+    //   O(1)
+    size_t get_size() const noexcept
+    {
+        return size;
+    }
+
+    //    O(1)
+    bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    //    O(1)
+    Type* data() const noexcept
+    {
+        return items;
+    }
+
+    //     O(1)
+    Type& front() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("View is empty!");
+        }
+        return items[0];
+    }
+
+    //     O(1)
+    Type& back() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("View is empty!");
+        }
+        return items[size - 1];
+    }
+
+    //      O(1)
+    Type& at(size_t index) const
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return items[index];
+    }
+
+//------------------------------------------------------------------------  ---------------------------------------------------------------------------
+
+    //  count    offset, count   . offset   -  O(1)
+    SimpleVectorView subview(size_t offset, size_t count = npos) const
+    {
+        if (offset > size)
+        {
+            throw std::out_of_range("Subview offset is out of range");
+        }
+        return SimpleVectorView(items + offset, std::min(count, size - offset));
+    }
+
+    //  count  O(1)
+    SimpleVectorView first(size_t count) const
+    {
+        if (count > size)
+        {
+            throw std::out_of_range("Subview is longer than view");
+        }
+        return SimpleVectorView(items, count);
+    }
+
+    //  count  O(1)
+    SimpleVectorView last(size_t count) const
+    {
+        if (count > size)
+        {
+            throw std::out_of_range("Subview is longer than view");
+        }
+        return SimpleVectorView(items + size - count, count);
+    }
+
+    //  count    O(1)
+    void remove_prefix(size_t count) noexcept
+    {
+        assert(count <= size);
+        items += count;
+        size -= count;
+    }
+
+    //  count    O(1)
+    void remove_suffix(size_t count) noexcept
+    {
+        assert(count <= size);
+        size -= count;
+    }
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------------
+
+private:
+
+    Type* items = nullptr;
+    size_t size = 0;
+};
+
+//    ,  ,    ,  
+template <typename Type>
+inline constexpr bool std::ranges::enable_borrowed_range<SimpleVectorView<Type>> = true;
+
+template <typename Type>
+inline constexpr bool std::ranges::enable_view<SimpleVectorView<Type>> = true;
+
+//     : SimpleVectorView view(vector)
+template <typename Container>
+SimpleVectorView(Container&) -> SimpleVectorView<std::remove_pointer_t<decltype(std::declval<Container&>().data())>>;
+
+template <typename Type>
+SimpleVectorView(std::span<Type>) -> SimpleVectorView<Type>;
+
+//=================================================    =========================================================
+
+template <typename Left, typename Right>
+    requires std::is_same_v<std::remove_const_t<Left>, std::remove_const_t<Right>>
+inline bool operator==(SimpleVectorView<Left> lhs, SimpleVectorView<Right> rhs)
+{
+    return simd_equal<std::remove_const_t<Left>>(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Left, typename Right>
+    requires std::is_same_v<std::remove_const_t<Left>, std::remove_const_t<Right>>
+inline bool operator!=(SimpleVectorView<Left> lhs, SimpleVectorView<Right> rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename Left, typename Right>
+    requires std::is_same_v<std::remove_const_t<Left>, std::remove_const_t<Right>>
+inline bool operator<(SimpleVectorView<Left> lhs, SimpleVectorView<Right> rhs)
+{
+    return simd_lexicographical_compare<std::remove_const_t<Left>>(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Left, typename Right>
+    requires std::is_same_v<std::remove_const_t<Left>, std::remove_const_t<Right>>
+inline bool operator<=(SimpleVectorView<Left> lhs, SimpleVectorView<Right> rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename Left, typename Right>
+    requires std::is_same_v<std::remove_const_t<Left>, std::remove_const_t<Right>>
+inline bool operator>(SimpleVectorView<Left> lhs, SimpleVectorView<Right> rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename Left, typename Right>
+    requires std::is_same_v<std::remove_const_t<Left>, std::remove_const_t<Right>>
+inline bool operator>=(SimpleVectorView<Left> lhs, SimpleVectorView<Right> rhs)
+{
+    return !(lhs < rhs);
+}
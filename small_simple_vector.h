@@ -0,0 +1,655 @@
+#pragma once
+
+#include "array_ptr.h"
+#include "growth_policy.h"
+#include "simd_algorithms.h"
+
+#include <cassert>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+// ,   N           N
+template <typename Type, size_t N, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DoublingGrowth>
+class SmallSimpleVector
+{
+    static_assert(N > 0, "Inline capacity must be positive");
+
+public:
+
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+    using allocator_type = Allocator;
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+//=====================================================================    ==========================================================
+
+    SmallSimpleVector() noexcept = default;
+
+    //      
+    explicit SmallSimpleVector(const Allocator& alloc) noexcept : heap(alloc){}
+
+    //      
+    explicit SmallSimpleVector(size_t size, const Allocator& alloc = Allocator()) : heap(alloc)
+    {
+        reserve(size);
+        heap.uninitialized_value_construct(data_ptr, size);
+        this->size = size;
+    }
+
+    //     
+    SmallSimpleVector(size_t size, const Type& value, const Allocator& alloc = Allocator()) : heap(alloc)
+    {
+        reserve(size);
+        heap.uninitialized_fill(data_ptr, size, value);
+        this->size = size;
+    }
+
+    //     {}
+    SmallSimpleVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator()) : heap(alloc)
+    {
+        reserve(init.size());
+        heap.uninitialized_copy(init.begin(), init.end(), data_ptr);
+        size = init.size();
+    }
+
+    //   O(N)
+    SmallSimpleVector(const SmallSimpleVector& other)
+        : heap(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator()))
+    {
+        reserve(other.size);
+        heap.uninitialized_copy(other.begin(), other.end(), data_ptr);
+        size = other.size;
+    }
+
+    //  ,     O(N)
+    SmallSimpleVector(SmallSimpleVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>)
+        : heap(other.get_allocator())
+    {
+        steal(other);
+    }
+
+    //   ,    ArrayPtr O(N)
+    ~SmallSimpleVector()
+    {
+        if (!is_inline())
+        {
+            VectorStats<Type>::released(capacity, size);
+        }
+        heap.destroy(data_ptr, data_ptr + size);
+    }
+
+//================================================================  ===============================================================================
+
+    //     O(1)
+    Type& operator[](size_t index) noexcept
+    {
+        assert(index < size);
+        return data_ptr[index];
+    }
+
+    //      O(1)
+    const Type& operator[](size_t index) const noexcept
+    {
+        assert(index < size);
+        return data_ptr[index];
+    }
+
+    //    O(N)
+    SmallSimpleVector& operator=(const SmallSimpleVector& rhs)
+    {
+        if (this != &rhs)
+        {
+            SmallSimpleVector temp(rhs);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    //   .  rhs ,      ,
+    //         O(N)
+    SmallSimpleVector& operator=(SmallSimpleVector&& rhs)
+        noexcept(std::is_nothrow_move_constructible_v<Type>
+            && (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value))
+    {
+        if (this != &rhs)
+        {
+            if (!is_inline())
+            {
+                VectorStats<Type>::released(capacity, size);
+            }
+            clear();
+            release_heap();
+
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+            {
+                heap = ArrayPtr<Type, Allocator>(rhs.get_allocator());
+                steal(rhs);
+            }
+            else if (rhs.is_inline() || get_allocator() == rhs.get_allocator())
+            {
+                steal(rhs);
+            }
+            else
+            {
+                reserve(rhs.size);
+                heap.uninitialized_move(rhs.data_ptr, rhs.data_ptr + rhs.size, data_ptr);
+                size = rhs.size;
+                rhs.clear();
+            }
+        }
+        return *this;
+    }
+
+//=====================================================================  ==========================================================================
+
+    //    O(1)
+    Iterator begin() noexcept
+    {
+        return data_ptr;
+    }
+
+    //    O(1)
+    Iterator end() noexcept
+    {
+        return data_ptr + size;
+    }
+
+    //     O(1)
+    ConstIterator begin() const noexcept
+    {
+        return data_ptr;
+    }
+
+    //     O(1)
+    ConstIterator end() const noexcept
+    {
+        return data_ptr + size;
+    }
+
+    // O(1)
+    ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    // O(1)
+    ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+//=====================================================================  =============================================================================
+
+//-------------------------------------------------------------    --------------------------------------------------------------------
+
+    //      O(N)
+    void push_back(const Type& item)
+    {
+        emplace_back(item);
+    }
+
+    //      O(N)
+    void push_back(Type&& item)
+    {
+        emplace_back(std::move(item));
+    }
+
+    //          O(N)
+    template <typename... Args>
+    Type& emplace_back(Args&&... args)
+    {
+        if (size + 1 > capacity)
+        {
+            size_t new_capacity = grow_capacity(size + 1);
+            ArrayPtr<Type, Allocator> temp(new_capacity, heap.get_allocator());
+
+            //      :     
+            temp.construct(temp.get() + size, std::forward<Args>(args)...);
+            relocate_around(temp, size);
+        }
+        else
+        {
+            heap.construct(data_ptr + size, std::forward<Args>(args)...);
+        }
+        ++size;
+
+        return data_ptr[size - 1];
+    }
+
+    //     c  O(N)
+    Iterator insert(ConstIterator pos, const Type& value)
+    {
+        return emplace(pos, value);
+    }
+
+    //       O(N)
+    Iterator insert(ConstIterator pos, Type&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    //         O(N)
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args)
+    {
+        assert(pos >= begin() && pos <= end());
+
+        size_t count = pos - data_ptr;
+
+        if (size < capacity)
+        {
+            if (count == size)
+            {
+                heap.construct(data_ptr + size, std::forward<Args>(args)...);
+            }
+            else
+            {
+                //      ,    
+                Type temp(std::forward<Args>(args)...);
+
+                heap.construct(data_ptr + size, std::move(data_ptr[size - 1]));
+                std::move_backward(data_ptr + count, data_ptr + size - 1, data_ptr + size);
+                data_ptr[count] = std::move(temp);
+                VectorStats<Type>::moved(size - count);
+            }
+        }
+        else
+        {
+            size_t new_capacity = grow_capacity(size + 1);
+            ArrayPtr<Type, Allocator> temp(new_capacity, heap.get_allocator());
+
+            temp.construct(temp.get() + count, std::forward<Args>(args)...);
+            relocate_around(temp, count);
+        }
+        ++size;
+
+        return data_ptr + count;
+    }
+
+//--------------------------------------------------------------   ------------------------------------------------------------------------
+
+    //   O(1)
+    size_t get_size() const noexcept
+    {
+        return size;
+    }
+
+    //   O(1)
+    size_t max_size() const
+    {
+        return std::numeric_limits<size_t>::max() / sizeof(Type);
+    }
+
+    //  O(1)
+    size_t get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+    //    O(1)
+    bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    //      O(1)
+    bool is_inline() const noexcept
+    {
+        return data_ptr == inline_data();
+    }
+
+    //     O(1)
+    Type& front()
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return data_ptr[0];
+    }
+
+    //      O(1)
+    const Type& front() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return data_ptr[0];
+    }
+
+    //     O(1)
+    Type& back()
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return data_ptr[size - 1];
+    }
+
+    //     O(1)
+    const Type& back() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return data_ptr[size - 1];
+    }
+
+    //     O(1)
+    Type* data()
+    {
+        return data_ptr;
+    }
+
+    //      O(1)
+    const Type* data() const
+    {
+        return data_ptr;
+    }
+
+    //      O(1)
+    Type& at(size_t index)
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return data_ptr[index];
+    }
+
+    //       O(1)
+    const Type& at(size_t index) const
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return data_ptr[index];
+    }
+
+//-------------------------------------------------------------------    --------------------------------------------------------------------
+
+    //   O(N)
+    void resize(size_t new_size)
+    {
+        if (new_size <= size)
+        {
+            heap.destroy(data_ptr + new_size, data_ptr + size);
+            size = new_size;
+            return;
+        }
+        if (new_size > capacity)
+        {
+            ArrayPtr<Type, Allocator> temp(grow_capacity(new_size), heap.get_allocator());
+
+            relocate(temp);
+        }
+        heap.uninitialized_value_construct(data_ptr + size, new_size - size);
+        size = new_size;
+    }
+
+    //    ,         O(N)
+    void shrink_to_fit()
+    {
+        if (is_inline() || size == capacity)
+        {
+            return;
+        }
+        if (size <= N)
+        {
+            record_reallocation();
+            heap.uninitialized_relocate(data_ptr, data_ptr + size, inline_data());
+
+            release_heap();
+        }
+        else
+        {
+            ArrayPtr<Type, Allocator> temp(size, heap.get_allocator());
+
+            relocate(temp);
+        }
+    }
+
+    //   O(N)
+    void reserve(size_t new_capacity)
+    {
+        if (new_capacity > capacity)
+        {
+            ArrayPtr<Type, Allocator> temp(new_capacity, heap.get_allocator());
+
+            relocate(temp);
+        }
+    }
+
+//------------------------------------------------------------------------    --------------------------------------------------------------
+
+    //  ,    O(N)
+    void clear() noexcept
+    {
+        heap.destroy(data_ptr, data_ptr + size);
+        size = 0;
+    }
+
+    //    O(1)
+    void pop_back() noexcept
+    {
+        assert(size > 0);
+
+        --size;
+        heap.destroy(data_ptr + size, data_ptr + size + 1);
+    }
+
+    //      O(N)
+    Iterator erase(ConstIterator pos)
+    {
+        assert(pos >= begin() && pos < end());
+
+        size_t count = pos - data_ptr;
+
+        std::move(data_ptr + count + 1, data_ptr + size, data_ptr + count);
+        VectorStats<Type>::moved(size - count - 1);
+        --size;
+        heap.destroy(data_ptr + size, data_ptr + size + 1);
+
+        return data_ptr + count;
+    }
+
+//---------------------------------------------------------------------   ----------------------------------------------------------------------
+
+    //    O(1)
+    Allocator get_allocator() const noexcept
+    {
+        return heap.get_allocator();
+    }
+
+    //  , O(1)         ,  O(N).  
+    //        ,  noexcept
+    //       
+    void swap(SmallSimpleVector& other)
+        noexcept(std::is_nothrow_move_constructible_v<Type>
+            && (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value))
+    {
+        if (!is_inline() && !other.is_inline()
+            && (AllocTraits::propagate_on_container_swap::value || get_allocator() == other.get_allocator()))
+        {
+            heap.swap(other.heap);
+            std::swap(data_ptr, other.data_ptr);
+            std::swap(size, other.size);
+            std::swap(capacity, other.capacity);
+        }
+        else
+        {
+            SmallSimpleVector temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+    }
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------------
+
+private:
+
+    ArrayPtr<Type, Allocator> heap;
+    alignas(Type) unsigned char buffer[N * sizeof(Type)];
+    Type* data_ptr = inline_data();
+    size_t size = 0;
+    size_t capacity = N;
+
+    //     required     O(1)
+    size_t grow_capacity(size_t required) const noexcept
+    {
+        return GrowthPolicy::next_capacity(capacity, required, sizeof(Type));
+    }
+
+    //    O(1)
+    Type* inline_data() noexcept
+    {
+        return reinterpret_cast<Type*>(buffer);
+    }
+
+    //     O(1)
+    const Type* inline_data() const noexcept
+    {
+        return reinterpret_cast<const Type*>(buffer);
+    }
+
+    //    ,        O(1)
+    void adopt(ArrayPtr<Type, Allocator>& new_heap) noexcept
+    {
+        heap.swap(new_heap);
+        data_ptr = heap.get();
+        capacity = heap.get_capacity();
+    }
+
+    //       ,     O(1)
+    void release_heap() noexcept
+    {
+        ArrayPtr<Type, Allocator> empty(heap.get_allocator());
+
+        heap.swap(empty);
+        data_ptr = inline_data();
+        capacity = N;
+    }
+
+    //     ,       O(1)
+    void record_reallocation() const noexcept
+    {
+        VectorStats<Type>::reallocated();
+        if (!is_inline())
+        {
+            VectorStats<Type>::released(capacity, size);
+        }
+    }
+
+    //        O(N)
+    void relocate(ArrayPtr<Type, Allocator>& new_heap)
+    {
+        record_reallocation();
+        new_heap.uninitialized_relocate(data_ptr, data_ptr + size, new_heap.get());
+
+        adopt(new_heap);
+    }
+
+    //                position.
+    //   ,  :     ,    O(N)
+    void relocate_around(ArrayPtr<Type, Allocator>& new_heap, size_t position)
+    {
+        Type* new_element = new_heap.get() + position;
+
+        record_reallocation();
+
+        if constexpr (is_trivially_relocatable_v<Type>)
+        {
+            new_heap.uninitialized_relocate(data_ptr, data_ptr + position, new_heap.get());
+            new_heap.uninitialized_relocate(data_ptr + position, data_ptr + size, new_element + 1);
+        }
+        else
+        {
+            try
+            {
+                Type* prefix_end = new_heap.uninitialized_move_if_noexcept(data_ptr, data_ptr + position, new_heap.get());
+                try
+                {
+                    new_heap.uninitialized_move_if_noexcept(data_ptr + position, data_ptr + size, new_element + 1);
+                }
+                catch (...)
+                {
+                    new_heap.destroy(new_heap.get(), prefix_end);
+                    throw;
+                }
+            }
+            catch (...)
+            {
+                new_heap.destroy(new_element, new_element + 1);
+                throw;
+            }
+            heap.destroy(data_ptr, data_ptr + size);
+        }
+
+        adopt(new_heap);
+    }
+
+    //     other:   ,   .
+    //   other     O(N)
+    void steal(SmallSimpleVector& other)
+    {
+        assert(size == 0 && is_inline());
+
+        if (other.is_inline())
+        {
+            heap.uninitialized_relocate(other.data_ptr, other.data_ptr + other.size, data_ptr);
+            size = std::exchange(other.size, 0);
+        }
+        else
+        {
+            adopt(other.heap);
+            size = std::exchange(other.size, 0);
+            other.data_ptr = other.inline_data();
+            other.capacity = N;
+        }
+    }
+};
+
+//=================================================    =========================================================
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator==(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs)
+{
+    return simd_equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator!=(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator<(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs)
+{
+    return simd_lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator<=(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator>(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs)
+{
+    return !(lhs <= rhs);
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator>=(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs)
+{
+    return !(lhs < rhs);
+}
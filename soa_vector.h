@@ -0,0 +1,1003 @@
+#pragma once
+
+#include "array_ptr.h"
+#include "growth_policy.h"
+#include "simd_algorithms.h"
+#include "simple_vector_view.h"
+
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//====================================================================    ====================================================================
+
+//       :        . 
+//     ,    .    - std::tuple<Fields...>
+template <typename... Refs>
+class SoARowRef
+{
+public:
+
+    using value_type = std::tuple<std::remove_const_t<Refs>...>;
+
+    explicit SoARowRef(Refs&... fields) noexcept : fields(fields...){}
+
+    SoARowRef(const SoARowRef&) noexcept = default;
+
+    //    
+    template <typename... Others>
+        requires (!std::is_same_v<std::tuple<Others...>, std::tuple<Refs...>>
+            && std::is_constructible_v<std::tuple<Refs&...>, const std::tuple<Others&...>&>)
+    SoARowRef(const SoARowRef<Others...>& other) noexcept : fields(other.fields){}
+
+    //        O(K)
+    const SoARowRef& operator=(const SoARowRef& other) const requires (!(std::is_const_v<Refs> || ...))
+    {
+        assign(other.fields);
+        return *this;
+    }
+
+    //     row O(K)
+    const SoARowRef& operator=(const value_type& row) const requires (!(std::is_const_v<Refs> || ...))
+    {
+        assign(row);
+        return *this;
+    }
+
+    //     row O(K)
+    const SoARowRef& operator=(value_type&& row) const requires (!(std::is_const_v<Refs> || ...))
+    {
+        assign(std::move(row));
+        return *this;
+    }
+
+    //    I
+    template <size_t I>
+    std::tuple_element_t<I, std::tuple<Refs&...>> get() const noexcept
+    {
+        return std::get<I>(fields);
+    }
+
+    //    O(K)
+    operator value_type() const
+    {
+        return value_type(fields);
+    }
+
+    friend bool operator==(const SoARowRef& lhs, const SoARowRef& rhs)
+    {
+        return lhs.fields == rhs.fields;
+    }
+
+    friend bool operator==(const SoARowRef& lhs, const value_type& rhs)
+    {
+        return lhs.fields == rhs;
+    }
+
+    //     
+    friend auto operator<=>(const SoARowRef& lhs, const SoARowRef& rhs)
+    {
+        return lhs.fields <=> rhs.fields;
+    }
+
+    friend auto operator<=>(const SoARowRef& lhs, const value_type& rhs)
+    {
+        return lhs.fields <=> rhs;
+    }
+
+    //    ,    O(K)
+    friend void swap(const SoARowRef& lhs, const SoARowRef& rhs) requires (!(std::is_const_v<Refs> || ...))
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            using std::swap;
+            (swap(std::get<I>(lhs.fields), std::get<I>(rhs.fields)), ...);
+        }(std::index_sequence_for<Refs...>());
+    }
+
+private:
+
+    template <typename...>
+    friend class SoARowRef;
+
+    std::tuple<Refs&...> fields;
+
+    //      row   O(K)
+    template <typename Row>
+    void assign(Row&& row) const
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            ((std::get<I>(fields) = std::get<I>(std::forward<Row>(row))), ...);
+        }(std::index_sequence_for<Refs...>());
+    }
+};
+
+//    I ,    : get<I>(row)    ,   std::tuple
+template <size_t I, typename... Refs>
+std::tuple_element_t<I, std::tuple<Refs&...>> get(const SoARowRef<Refs...>& row) noexcept
+{
+    return row.template get<I>();
+}
+
+//    : auto [id, score] = vector[i]    
+template <typename... Refs>
+struct std::tuple_size<SoARowRef<Refs...>> : std::integral_constant<size_t, sizeof...(Refs)>
+{
+};
+
+template <size_t I, typename... Refs>
+struct std::tuple_element<I, SoARowRef<Refs...>>
+{
+    using type = std::tuple_element_t<I, std::tuple<Refs...>>&;
+};
+
+//         - ,     std::ranges
+template <typename... Refs, template <typename> typename RefQual, template <typename> typename ValueQual>
+struct std::basic_common_reference<SoARowRef<Refs...>, std::tuple<std::remove_const_t<Refs>...>, RefQual, ValueQual>
+{
+    using type = std::tuple<std::remove_const_t<Refs>...>;
+};
+
+template <typename... Refs, template <typename> typename ValueQual, template <typename> typename RefQual>
+struct std::basic_common_reference<std::tuple<std::remove_const_t<Refs>...>, SoARowRef<Refs...>, ValueQual, RefQual>
+{
+    using type = std::tuple<std::remove_const_t<Refs>...>;
+};
+
+//======================================================================  ==========================================================================
+
+//     :       .
+//   SoARowRef  
+template <typename... Fields>
+class SoAIterator
+{
+public:
+
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::tuple<std::remove_const_t<Fields>...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = SoARowRef<Fields...>;
+    using pointer = void;
+
+    SoAIterator() noexcept = default;
+
+    SoAIterator(const std::tuple<Fields*...>& columns, size_t index) noexcept : columns(columns), index(index){}
+
+    //    
+    template <typename... Others>
+        requires (!std::is_same_v<std::tuple<Others...>, std::tuple<Fields...>>
+            && std::is_convertible_v<std::tuple<Others*...>, std::tuple<Fields*...>>)
+    SoAIterator(const SoAIterator<Others...>& other) noexcept : columns(other.columns), index(other.index){}
+
+    reference operator*() const noexcept
+    {
+        return std::apply([this](Fields*... column) { return reference(column[index]...); }, columns);
+    }
+
+    reference operator[](difference_type offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+
+    SoAIterator& operator++() noexcept
+    {
+        ++index;
+        return *this;
+    }
+
+    SoAIterator operator++(int) noexcept
+    {
+        SoAIterator previous = *this;
+        ++index;
+        return previous;
+    }
+
+    SoAIterator& operator--() noexcept
+    {
+        --index;
+        return *this;
+    }
+
+    SoAIterator operator--(int) noexcept
+    {
+        SoAIterator previous = *this;
+        --index;
+        return previous;
+    }
+
+    SoAIterator& operator+=(difference_type offset) noexcept
+    {
+        index += offset;
+        return *this;
+    }
+
+    SoAIterator& operator-=(difference_type offset) noexcept
+    {
+        index -= offset;
+        return *this;
+    }
+
+    friend SoAIterator operator+(SoAIterator it, difference_type offset) noexcept
+    {
+        return it += offset;
+    }
+
+    friend SoAIterator operator+(difference_type offset, SoAIterator it) noexcept
+    {
+        return it += offset;
+    }
+
+    friend SoAIterator operator-(SoAIterator it, difference_type offset) noexcept
+    {
+        return it -= offset;
+    }
+
+    friend difference_type operator-(const SoAIterator& lhs, const SoAIterator& rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.index - rhs.index);
+    }
+
+    friend bool operator==(const SoAIterator& lhs, const SoAIterator& rhs) noexcept
+    {
+        return lhs.index == rhs.index;
+    }
+
+    friend std::strong_ordering operator<=>(const SoAIterator& lhs, const SoAIterator& rhs) noexcept
+    {
+        return lhs.index <=> rhs.index;
+    }
+
+private:
+
+    template <typename...>
+    friend class SoAIterator;
+
+    std::tuple<Fields*...> columns;
+    size_t index = 0;
+};
+
+//====================================================================   =====================================================================
+
+//     Fields...,        (structure of arrays).
+//          . , ,   
+//     SimpleVector,    SoARowRef
+template <typename GrowthPolicy, typename... Fields>
+class BasicSoAVector
+{
+    static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+    static_assert((!std::is_const_v<Fields> && ...) && (!std::is_reference_v<Fields> && ...), "Fields must be plain object types");
+
+public:
+
+    using value_type = std::tuple<Fields...>;
+    using Reference = SoARowRef<Fields...>;
+    using ConstReference = SoARowRef<const Fields...>;
+    using Iterator = SoAIterator<Fields...>;
+    using ConstIterator = SoAIterator<const Fields...>;
+
+    template <size_t I>
+    using FieldType = std::tuple_element_t<I, value_type>;
+
+//=====================================================================    ==========================================================
+
+    BasicSoAVector() noexcept = default;
+
+    //       O(N)
+    explicit BasicSoAVector(size_t size) : BasicSoAVector()
+    {
+        resize(size);
+    }
+
+    //    size   value O(N)
+    BasicSoAVector(size_t size, const value_type& value) : BasicSoAVector()
+    {
+        reserve(size);
+        for_each_column(columns, [&](auto& column, auto field)
+        {
+            column.uninitialized_fill(column.get(), size, std::get<field>(value));
+        },
+        [&](auto& column)
+        {
+            column.destroy(column.get(), column.get() + size);
+        });
+        this->size = size;
+    }
+
+    //     {}
+    BasicSoAVector(std::initializer_list<value_type> init) : BasicSoAVector()
+    {
+        reserve(init.size());
+        for (const value_type& row : init)
+        {
+            push_back(row);
+        }
+    }
+
+    //  ,    O(N)
+    BasicSoAVector(const BasicSoAVector& other) : BasicSoAVector()
+    {
+        reserve(other.size);
+        for_each_column(columns, [&](auto& column, auto field)
+        {
+            const auto* source = std::get<field>(other.columns).get();
+            column.uninitialized_copy(source, source + other.size, column.get());
+        },
+        [&](auto& column)
+        {
+            column.destroy(column.get(), column.get() + other.size);
+        });
+        size = other.size;
+    }
+
+    //  
+    BasicSoAVector(BasicSoAVector&& other) noexcept
+        : columns(std::move(other.columns)), size(std::exchange(other.size, 0)), capacity(std::exchange(other.capacity, 0)){}
+
+    //   ,    ArrayPtr O(N)
+    ~BasicSoAVector()
+    {
+        (VectorStats<Fields>::released(capacity, size), ...);
+        destroy_rows(0, size);
+    }
+
+//================================================================  ===============================================================================
+
+    //      O(1)
+    Reference operator[](size_t index) noexcept
+    {
+        assert(index < size);
+        return begin()[index];
+    }
+
+    //       O(1)
+    ConstReference operator[](size_t index) const noexcept
+    {
+        assert(index < size);
+        return begin()[index];
+    }
+
+    //    O(N)
+    BasicSoAVector& operator=(const BasicSoAVector& rhs)
+    {
+        if (this != &rhs)
+        {
+            BasicSoAVector temp(rhs);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    //    O(N)    
+    BasicSoAVector& operator=(BasicSoAVector&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            BasicSoAVector temp(std::move(rhs));
+            swap(temp);
+        }
+        return *this;
+    }
+
+//=====================================================================  ==========================================================================
+
+    //    O(1)
+    Iterator begin() noexcept
+    {
+        return Iterator(pointers(), 0);
+    }
+
+    //    O(1)
+    Iterator end() noexcept
+    {
+        return Iterator(pointers(), size);
+    }
+
+    //     O(1)
+    ConstIterator begin() const noexcept
+    {
+        return ConstIterator(pointers(), 0);
+    }
+
+    //     O(1)
+    ConstIterator end() const noexcept
+    {
+        return ConstIterator(pointers(), size);
+    }
+
+    // O(1)
+    ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    // O(1)
+    ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+//=====================================================================  =============================================================================
+
+//-------------------------------------------------------------    --------------------------------------------------------------------
+
+    //       O(N)
+    void push_back(const value_type& row)
+    {
+        std::apply([this](const Fields&... fields) { emplace_back(fields...); }, row);
+    }
+
+    //       O(N)
+    void push_back(value_type&& row)
+    {
+        std::apply([this](Fields&... fields) { emplace_back(std::move(fields)...); }, row);
+    }
+
+    //    ,      O(N)
+    template <typename... Args>
+    Reference emplace_back(Args&&... args)
+    {
+        static_assert(sizeof...(Args) == sizeof...(Fields), "emplace_back takes one argument per field");
+
+        if (size + 1 > capacity)
+        {
+            Columns temp = allocate(grow_capacity(size + 1));
+
+            //      :     
+            construct_row(temp, size, std::forward<Args>(args)...);
+            relocate_around(temp, size, 1);
+        }
+        else
+        {
+            construct_row(columns, size, std::forward<Args>(args)...);
+        }
+        ++size;
+
+        return (*this)[size - 1];
+    }
+
+    //       O(N)
+    Iterator insert(ConstIterator pos, const value_type& row)
+    {
+        return std::apply([this, pos](const Fields&... fields) { return emplace(pos, fields...); }, row);
+    }
+
+    //        O(N)
+    Iterator insert(ConstIterator pos, value_type&& row)
+    {
+        return std::apply([this, pos](Fields&... fields) { return emplace(pos, std::move(fields)...); }, row);
+    }
+
+    //     ,     .    ,
+    //          ( ) O(N)
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args)
+    {
+        static_assert(sizeof...(Args) == sizeof...(Fields), "emplace takes one argument per field");
+        assert(pos >= cbegin() && pos <= cend());
+
+        size_t index = pos - cbegin();
+
+        if (index == size)
+        {
+            emplace_back(std::forward<Args>(args)...);
+        }
+        else if (size < capacity)
+        {
+            //      ,    
+            value_type temp(std::forward<Args>(args)...);
+
+            for_each_column(columns, [&](auto& column, auto field)
+            {
+                auto* items = column.get();
+                column.construct(items + size, std::move(items[size - 1]));
+                try
+                {
+                    std::move_backward(items + index, items + size - 1, items + size);
+                    items[index] = std::move(std::get<field>(temp));
+                }
+                catch (...)
+                {
+                    column.destroy(items + size, items + size + 1);
+                    throw;
+                }
+                VectorStats<FieldType<field>>::moved(size - index);
+            },
+            [&](auto& column)
+            {
+                column.destroy(column.get() + size, column.get() + size + 1);
+            });
+            ++size;
+        }
+        else
+        {
+            Columns temp = allocate(grow_capacity(size + 1));
+
+            construct_row(temp, index, std::forward<Args>(args)...);
+            relocate_around(temp, index, 1);
+            ++size;
+        }
+
+        return begin() + index;
+    }
+
+//--------------------------------------------------------------   ------------------------------------------------------------------------
+
+    //   O(1)
+    size_t get_size() const noexcept
+    {
+        return size;
+    }
+
+    //  ,     O(1)
+    size_t max_size() const noexcept
+    {
+        return std::numeric_limits<size_t>::max() / std::max({ sizeof(Fields)... });
+    }
+
+    //  O(1)
+    size_t get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+    //    O(1)
+    bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    //     O(1)
+    Reference front()
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[0];
+    }
+
+    //      O(1)
+    ConstReference front() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[0];
+    }
+
+    //     O(1)
+    Reference back()
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[size - 1];
+    }
+
+    //      O(1)
+    ConstReference back() const
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Vector is empty!");
+        }
+        return (*this)[size - 1];
+    }
+
+    //        O(1)
+    Reference at(size_t index)
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return (*this)[index];
+    }
+
+    //         O(1)
+    ConstReference at(size_t index) const
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return (*this)[index];
+    }
+
+    //      I O(1)
+    template <size_t I>
+    FieldType<I>* data() noexcept
+    {
+        return std::get<I>(columns).get();
+    }
+
+    //       I O(1)
+    template <size_t I>
+    const FieldType<I>* data() const noexcept
+    {
+        return std::get<I>(columns).get();
+    }
+
+    //   I O(1)
+    template <size_t I>
+    SimpleVectorView<FieldType<I>> column() noexcept
+    {
+        return SimpleVectorView<FieldType<I>>(data<I>(), size);
+    }
+
+    //    I O(1)
+    template <size_t I>
+    SimpleVectorView<const FieldType<I>> column() const noexcept
+    {
+        return SimpleVectorView<const FieldType<I>>(data<I>(), size);
+    }
+
+//-------------------------------------------------------------------    --------------------------------------------------------------------
+
+    //  ,         O(N)
+    void resize(size_t new_size)
+    {
+        if (new_size <= size)
+        {
+            destroy_rows(new_size, size);
+            size = new_size;
+            return;
+        }
+        if (new_size > capacity)
+        {
+            reallocate(grow_capacity(new_size));
+        }
+        for_each_column(columns, [&](auto& column, auto)
+        {
+            column.uninitialized_value_construct(column.get() + size, new_size - size);
+        },
+        [&](auto& column)
+        {
+            column.destroy(column.get() + size, column.get() + new_size);
+        });
+        size = new_size;
+    }
+
+    //     O(N)
+    void shrink_to_fit()
+    {
+        if (size < capacity)
+        {
+            reallocate(size);
+        }
+    }
+
+    //      O(N)
+    void reserve(size_t new_capacity)
+    {
+        if (new_capacity > capacity)
+        {
+            reallocate(new_capacity);
+        }
+    }
+
+//------------------------------------------------------------------------    --------------------------------------------------------------
+
+    //   O(N)
+    void clear() noexcept
+    {
+        destroy_rows(0, size);
+        size = 0;
+    }
+
+    //    O(1)
+    void pop_back() noexcept
+    {
+        assert(size > 0);
+
+        --size;
+        destroy_rows(size, size + 1);
+    }
+
+    //      O(N)
+    Iterator erase(ConstIterator pos)
+    {
+        assert(pos >= cbegin() && pos < cend());
+
+        return erase(pos, pos + 1);
+    }
+
+    //   [first, last),       O(N)
+    Iterator erase(ConstIterator first, ConstIterator last)
+    {
+        assert(first >= cbegin() && first <= last && last <= cend());
+
+        size_t index = first - cbegin();
+        size_t tail = last - cbegin();
+
+        //  :         
+        if (index == tail)
+        {
+            return begin() + index;
+        }
+
+        for_each_column(columns, [&](auto& column, auto field)
+        {
+            std::move(column.get() + tail, column.get() + size, column.get() + index);
+            VectorStats<FieldType<field>>::moved(size - tail);
+        });
+
+        size_t new_size = size - (tail - index);
+        destroy_rows(new_size, size);
+        size = new_size;
+
+        return begin() + index;
+    }
+
+    //     :       O(1)
+    Iterator unordered_erase(ConstIterator pos)
+    {
+        assert(pos >= cbegin() && pos < cend());
+
+        size_t index = pos - cbegin();
+
+        if (index != size - 1)
+        {
+            move_row(index, size - 1);
+        }
+        pop_back();
+
+        return begin() + index;
+    }
+
+    //   ,   predicate(ConstReference) ,     
+    // .     O(N)
+    template <typename Predicate>
+    size_t erase_if(Predicate predicate)
+    {
+        size_t kept = 0;
+        for (size_t index = 0; index < size; ++index)
+        {
+            if (predicate(std::as_const(*this)[index]))
+            {
+                continue;
+            }
+            if (kept != index)
+            {
+                move_row(kept, index);
+            }
+            ++kept;
+        }
+
+        size_t removed = size - kept;
+        destroy_rows(kept, size);
+        size = kept;
+
+        return removed;
+    }
+
+//---------------------------------------------------------------------   ----------------------------------------------------------------------
+
+    //   O(K)
+    void swap(BasicSoAVector& other) noexcept
+    {
+        for_each_column(columns, [&](auto& column, auto field)
+        {
+            column.swap(std::get<field>(other.columns));
+        });
+        std::swap(size, other.size);
+        std::swap(capacity, other.capacity);
+    }
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------------
+
+private:
+
+    using Columns = std::tuple<ArrayPtr<Fields>...>;
+
+    Columns columns;
+    size_t size = 0;
+    size_t capacity = 0;
+
+    //  action(column, field)    target  ,
+    // field -     std::integral_constant O(K)
+    template <typename Action>
+    static void for_each_column(Columns& target, Action action)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            (action(std::get<I>(target), std::integral_constant<size_t, I>()), ...);
+        }(std::index_sequence_for<Fields...>());
+    }
+
+    //  ,   action  ,      rollback(column),
+    //         O(K)
+    template <typename Action, typename Rollback>
+    static void for_each_column(Columns& target, Action action, Rollback rollback)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            size_t done = 0;
+            try
+            {
+                ((action(std::get<I>(target), std::integral_constant<size_t, I>()), ++done), ...);
+            }
+            catch (...)
+            {
+                ((I < done ? rollback(std::get<I>(target)) : void()), ...);
+                throw;
+            }
+        }(std::index_sequence_for<Fields...>());
+    }
+
+    //     O(K)
+    std::tuple<Fields*...> pointers() const noexcept
+    {
+        return std::apply([](const ArrayPtr<Fields>&... column) { return std::tuple<Fields*...>(column.get()...); }, columns);
+    }
+
+    //     required    ,   -   O(1)
+    size_t grow_capacity(size_t required) const noexcept
+    {
+        return GrowthPolicy::next_capacity(capacity, required, (sizeof(Fields) + ...));
+    }
+
+    //    count     O(K)
+    static Columns allocate(size_t count)
+    {
+        return Columns(ArrayPtr<Fields>(count)...);
+    }
+
+    //   index   target,       O(K)
+    template <typename... Args>
+    static void construct_row(Columns& target, size_t index, Args&&... args)
+    {
+        auto arguments = std::forward_as_tuple(std::forward<Args>(args)...);
+
+        for_each_column(target, [&](auto& column, auto field)
+        {
+            column.construct(column.get() + index, std::get<field>(std::move(arguments)));
+        },
+        [&](auto& column)
+        {
+            column.destroy(column.get() + index, column.get() + index + 1);
+        });
+    }
+
+    //   [first, last) O(N)
+    void destroy_rows(size_t first, size_t last) noexcept
+    {
+        for_each_column(columns, [&](auto& column, auto)
+        {
+            column.destroy(column.get() + first, column.get() + last);
+        });
+    }
+
+    //    from   to O(K)
+    void move_row(size_t to, size_t from)
+    {
+        for_each_column(columns, [&](auto& column, auto field)
+        {
+            column[to] = std::move(column[from]);
+            VectorStats<FieldType<field>>::moved(1);
+        });
+    }
+
+    //            count    position.
+    //       (move_if_noexcept),     
+    // ,         ( ) O(N)
+    void relocate_around(Columns& target, size_t position, size_t count)
+    {
+        try
+        {
+            for_each_column(target, [&](auto& column, auto field)
+            {
+                using Type = FieldType<field>;
+
+                Type* old_items = std::get<field>(columns).get();
+                Type* new_items = column.get();
+
+                if constexpr (is_trivially_relocatable_v<Type>)
+                {
+                    //         
+                    column.uninitialized_relocate(old_items, old_items + position, new_items);
+                    column.uninitialized_relocate(old_items + position, old_items + size, new_items + position + count);
+                }
+                else
+                {
+                    Type* prefix_end = column.uninitialized_move_if_noexcept(old_items, old_items + position, new_items);
+                    try
+                    {
+                        column.uninitialized_move_if_noexcept(old_items + position, old_items + size, new_items + position + count);
+                    }
+                    catch (...)
+                    {
+                        column.destroy(new_items, prefix_end);
+                        throw;
+                    }
+                }
+            },
+            [&](auto& column)
+            {
+                using Type = std::remove_pointer_t<decltype(column.get())>;
+
+                if constexpr (!is_trivially_relocatable_v<Type>)
+                {
+                    column.destroy(column.get(), column.get() + position);
+                    column.destroy(column.get() + position + count, column.get() + size + count);
+                }
+            });
+        }
+        catch (...)
+        {
+            for_each_column(target, [&](auto& column, auto)
+            {
+                column.destroy(column.get() + position, column.get() + position + count);
+            });
+            throw;
+        }
+
+        record_reallocation();
+        for_each_column(columns, [&](auto& column, auto field)
+        {
+            if constexpr (!is_trivially_relocatable_v<FieldType<field>>)
+            {
+                column.destroy(column.get(), column.get() + size);
+            }
+        });
+
+        columns.swap(target);
+        capacity = std::get<0>(columns).get_capacity();
+    }
+
+    //        O(K)
+    void record_reallocation() const noexcept
+    {
+        if (capacity != 0)
+        {
+            (VectorStats<Fields>::reallocated(), ...);
+            (VectorStats<Fields>::released(capacity, size), ...);
+        }
+    }
+
+    //        O(N)
+    void reallocate(size_t new_capacity)
+    {
+        Columns temp = allocate(new_capacity);
+
+        relocate_around(temp, size, 0);
+    }
+};
+
+//      2 ,   SimpleVector  
+template <typename... Fields>
+using SoAVector = BasicSoAVector<DoublingGrowth, Fields...>;
+
+//=================================================    =========================================================
+
+//     ,    simd_equal O(N)
+template <typename GrowthPolicy, typename... Fields>
+inline bool operator==(const BasicSoAVector<GrowthPolicy, Fields...>& lhs, const BasicSoAVector<GrowthPolicy, Fields...>& rhs)
+{
+    if (lhs.get_size() != rhs.get_size())
+    {
+        return false;
+    }
+    return [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        return (simd_equal(lhs.template data<I>(), lhs.template data<I>() + lhs.get_size(),
+            rhs.template data<I>(), rhs.template data<I>() + rhs.get_size()) && ...);
+    }(std::index_sequence_for<Fields...>());
+}
+
+template <typename GrowthPolicy, typename... Fields>
+inline bool operator!=(const BasicSoAVector<GrowthPolicy, Fields...>& lhs, const BasicSoAVector<GrowthPolicy, Fields...>& rhs)
+{
+    return !(lhs == rhs);
+}
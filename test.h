@@ -1,12 +1,30 @@
 #pragma once
 
 #include "simple_vector.h"
+#include "small_simple_vector.h"
+#include "malloc_allocator.h"
+#include "mmap_allocator.h"
+#include "mapped_simple_vector.h"
+#include "parallel_algorithms.h"
+#include "concurrent_vector.h"
+#include "soa_vector.h"
+#include "vector_serialization.h"
+#include "simple_vector_view.h"
+#include "cow_simple_vector.h"
+#include "persistent_simple_vector.h"
+#include "chunked_simple_vector.h"
+#include "log.h"
 
 #include <cassert>
 #include <iostream>
 #include <utility>
 #include <algorithm>
+#include <filesystem>
+#include <iterator>
 #include <numeric>
+#include <ranges>
+#include <sstream>
+#include <string>
 
 using namespace std;
 
@@ -509,11 +527,2312 @@ inline void Test3()
     }
 }
 
+//   ,     
+class Counted
+{
+public:
+    explicit Counted(int value) : value(value)
+    {
+        ++alive;
+    }
+
+    Counted(const Counted& other) : value(other.value)
+    {
+        ++alive;
+    }
+
+    Counted& operator=(const Counted& other) = default;
+
+    ~Counted()
+    {
+        --alive;
+    }
+
+    int get_value() const
+    {
+        return value;
+    }
+
+    inline static int alive = 0;
+
+private:
+    int value;
+};
+
+inline void Test4()
+{
+    {
+        SimpleVector<Counted> v(reserve(100));
+
+        assert(v.get_capacity() == 100);
+        assert(v.get_size() == 0);
+        assert(Counted::alive == 0);
+
+        v.push_back(Counted(1));
+        v.push_back(Counted(2));
+
+        assert(Counted::alive == 2);
+
+        v.reserve(1000);
+
+        assert(Counted::alive == 2);
+        assert(v[1].get_value() == 2);
+
+        v.pop_back();
+
+        assert(Counted::alive == 1);
+
+        v.insert(v.begin(), Counted(0));
+        v.insert(v.end(), Counted(3));
+
+        assert(Counted::alive == 3);
+        assert(v[0].get_value() == 0 && v[1].get_value() == 1 && v[2].get_value() == 3);
+
+        v.erase(v.begin());
+
+        assert(Counted::alive == 2);
+
+        v.clear();
+
+        assert(Counted::alive == 0);
+    }
+
+    {
+        {
+            SimpleVector<Counted> v(3, Counted(7));
+            SimpleVector<Counted> copy(v);
+
+            assert(copy.get_capacity() == 3);
+            assert(Counted::alive == 6);
+
+            v.assign(1, Counted(8));
+
+            assert(Counted::alive == 4);
+
+            v.push_back(v[0]);
+
+            assert(v[1].get_value() == 8);
+        }
+
+        assert(Counted::alive == 0);
+    }
+}
+
+inline void Test5()
+{
+    {
+        SimpleVector<std::pair<int, std::string>> v;
+
+        auto& first = v.emplace_back(1, "one"s);
+
+        assert(first.first == 1 && first.second == "one"s);
+
+        v.emplace_back(3, "three"s);
+        auto it = v.emplace(v.begin() + 1, 2, "two"s);
+
+        assert(it == v.begin() + 1);
+        assert(v.get_size() == 3);
+        assert(v[1].second == "two"s && v[2].second == "three"s);
+
+        v.emplace(v.begin(), 0, "zero"s);
+
+        assert(v.front().first == 0 && v.back().first == 3);
+    }
+
+    {
+        SimpleVector<Counted> v;
+
+        v.emplace_back(1);
+        v.emplace_back(2);
+        v.emplace(v.begin(), 0);
+
+        assert(Counted::alive == 3);
+        assert(v[0].get_value() == 0 && v[2].get_value() == 2);
+    }
+
+    assert(Counted::alive == 0);
+
+    {
+        SimpleVector<X> v;
+
+        v.emplace_back(1u);
+        v.emplace(v.begin(), 0u);
+
+        assert(v[0].get_x() == 0 && v[1].get_x() == 1);
+    }
+}
+
+// ,   
+template <typename Type>
+class CountingAllocator
+{
+public:
+    using value_type = Type;
+
+    CountingAllocator() = default;
+
+    template <typename Other>
+    CountingAllocator(const CountingAllocator<Other>&) noexcept {}
+
+    Type* allocate(size_t count)
+    {
+        ++allocations;
+        return std::allocator<Type>().allocate(count);
+    }
+
+    void deallocate(Type* ptr, size_t count) noexcept
+    {
+        ++deallocations;
+        std::allocator<Type>().deallocate(ptr, count);
+    }
+
+    bool operator==(const CountingAllocator&) const noexcept
+    {
+        return true;
+    }
+
+    inline static size_t allocations = 0;
+    inline static size_t deallocations = 0;
+};
+
+inline void Test6()
+{
+    {
+        {
+            SimpleVector<int, CountingAllocator<int>> v;
+
+            for (int i = 0; i < 9; ++i)
+            {
+                v.push_back(i);
+            }
+
+            v.insert(v.begin(), 42);
+            v.resize(40);
+            v.shrink_to_fit();
+            v.assign(100, 1);
+
+            SimpleVector<int, CountingAllocator<int>> copy(v);
+
+            assert(copy == v);
+        }
+
+        assert(CountingAllocator<int>::allocations > 0);
+        assert(CountingAllocator<int>::allocations == CountingAllocator<int>::deallocations);
+    }
+
+    {
+        char buffer[4096];
+        std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+        PmrSimpleVector<int> v(&arena);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            v.push_back(i);
+        }
+
+        assert(v.get_allocator().resource() == &arena);
+        assert(reinterpret_cast<char*>(v.data()) >= buffer && reinterpret_cast<char*>(v.data()) < buffer + sizeof(buffer));
+
+        PmrSimpleVector<int> moved(std::move(v));
+
+        assert(moved.get_allocator().resource() == &arena);
+        assert(moved.get_size() == 100 && v.get_size() == 0);
+
+        PmrSimpleVector<int> other;
+        other = moved;
+
+        assert(other == moved);
+        assert(other.get_allocator().resource() == std::pmr::get_default_resource());
+    }
+}
+
+inline void Test7()
+{
+    {
+        SmallSimpleVector<int, 4, CountingAllocator<int>> v{ 1, 2, 3 };
+        const size_t allocations = CountingAllocator<int>::allocations;
+
+        v.push_back(4);
+
+        assert(v.is_inline());
+        assert(v.get_capacity() == 4);
+        assert(CountingAllocator<int>::allocations == allocations);
+
+        v.insert(v.begin(), 0);
+
+        assert(!v.is_inline());
+        assert(CountingAllocator<int>::allocations == allocations + 1);
+        assert((v == SmallSimpleVector<int, 4, CountingAllocator<int>>{0, 1, 2, 3, 4}));
+
+        v.erase(v.begin() + 1);
+        v.resize(3);
+        v.shrink_to_fit();
+
+        assert(v.is_inline());
+        assert((v == SmallSimpleVector<int, 4, CountingAllocator<int>>{0, 2, 3}));
+        assert((v < SmallSimpleVector<int, 4, CountingAllocator<int>>{0, 2, 4}));
+    }
+
+    {
+        SmallSimpleVector<Counted, 2> small;
+        SmallSimpleVector<Counted, 2> big;
+
+        small.emplace_back(1);
+
+        for (int i = 0; i < 5; ++i)
+        {
+            big.emplace_back(i);
+        }
+
+        small.swap(big);
+
+        assert(small.get_size() == 5 && big.get_size() == 1);
+        assert(big.is_inline() && !small.is_inline());
+        assert(small[4].get_value() == 4 && big[0].get_value() == 1);
+
+        SmallSimpleVector<Counted, 2> copy(small);
+        SmallSimpleVector<Counted, 2> moved(std::move(big));
+
+        assert(copy.get_size() == 5 && moved[0].get_value() == 1);
+        assert(Counted::alive == 11);
+    }
+
+    assert(Counted::alive == 0);
+
+    {
+        SmallSimpleVector<std::string, 2> v;
+
+        v.push_back("a"s);
+        v.push_back("b"s);
+
+        SmallSimpleVector<std::string, 2> moved = std::move(v);
+
+        assert(moved.back() == "b"s && v.is_empty());
+    }
+
+    {
+        //        :      
+        char first_buffer[4096];
+        char second_buffer[4096];
+        std::pmr::monotonic_buffer_resource first(first_buffer, sizeof(first_buffer), std::pmr::null_memory_resource());
+        std::pmr::monotonic_buffer_resource second(second_buffer, sizeof(second_buffer), std::pmr::null_memory_resource());
+
+        using PmrSmall = SmallSimpleVector<std::string, 2, std::pmr::polymorphic_allocator<std::string>>;
+        PmrSmall target(&first);
+        PmrSmall source(&second);
+        for (int i = 0; i < 5; ++i)
+        {
+            target.push_back(std::to_string(i));
+            source.push_back(std::to_string(i + 10));
+        }
+
+        target = std::move(source);
+
+        assert(target.get_allocator().resource() == &first && target.get_size() == 5 && target[4] == "14"s);
+        assert(reinterpret_cast<char*>(target.begin()) >= first_buffer && reinterpret_cast<char*>(target.begin()) < first_buffer + sizeof(first_buffer));
+
+        //  :    
+        PmrSmall same(&first);
+        same = std::move(target);
+        assert(same.get_size() == 5 && same[0] == "10"s && target.is_empty() && target.is_inline());
+
+        //      ,       
+        static_assert(!noexcept(same.swap(target)) && noexcept(std::declval<SmallSimpleVector<std::string, 2>&>().swap(std::declval<SmallSimpleVector<std::string, 2>&>())));
+        PmrSmall small(&second);
+        small.push_back("x");
+        same.swap(small);
+        assert(same.get_size() == 1 && same[0] == "x"s && same.get_allocator().resource() == &first);
+        assert(small.get_size() == 5 && small[4] == "14"s && small.get_allocator().resource() == &second);
+
+        small.push_back("y");
+        same.push_back("z");
+        same.push_back("w");
+        assert(!small.is_inline() && !same.is_inline());
+        same.swap(small);
+        assert(same.get_size() == 6 && same[5] == "y"s && small.get_size() == 3 && small[2] == "w"s);
+        assert(reinterpret_cast<char*>(small.begin()) >= second_buffer && reinterpret_cast<char*>(small.begin()) < second_buffer + sizeof(second_buffer));
+    }
+}
+
+//  ,    ,   
+class Handle
+{
+public:
+    explicit Handle(int value) : value(std::make_unique<int>(value)) {}
+
+    int get() const
+    {
+        return *value;
+    }
+
+private:
+    std::unique_ptr<int> value;
+};
+
+template <>
+struct IsTriviallyRelocatable<Handle> : std::true_type
+{
+};
+
+inline void Test8()
+{
+    static_assert(is_trivially_relocatable_v<int>);
+    static_assert(!is_trivially_relocatable_v<std::string>);
+    static_assert(ArrayPtr<int, MallocAllocator<int>>::can_reallocate);
+    static_assert(!ArrayPtr<int>::can_reallocate);
+
+    {
+        SimpleVector<int, MallocAllocator<int>> v;
+
+        for (int i = 0; i < 100000; ++i)
+        {
+            v.push_back(i);
+        }
+
+        v.insert(v.begin(), -1);
+        v.emplace(v.begin() + 1, v[0]);
+        v.resize(300000);
+        v.shrink_to_fit();
+
+        assert(v.get_size() == 300000 && v.get_capacity() == 300000);
+        assert(v[0] == -1 && v[1] == -1 && v[2] == 0 && v[100001] == 99999 && v[100002] == 0);
+
+        v.push_back(v[100001]);
+
+        assert(v.back() == 99999);
+    }
+
+    {
+        SimpleVector<Handle> v;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            v.emplace_back(i);
+        }
+
+        v.emplace(v.begin() + 50, -1);
+
+        assert(v[49].get() == 49 && v[50].get() == -1 && v[51].get() == 50 && v.back().get() == 99);
+
+        SimpleVector<Handle, MallocAllocator<Handle>> m;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            m.emplace_back(i);
+        }
+        m.reserve(1000);
+
+        assert(m[99].get() == 99);
+    }
+}
+
+//    count   
+template <typename GrowthPolicy>
+size_t CapacityAfterPushes(size_t count)
+{
+    SimpleVector<int, std::allocator<int>, GrowthPolicy> v;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        v.push_back(static_cast<int>(i));
+    }
+    return v.get_capacity();
+}
+
+inline void Test9()
+{
+    assert(CapacityAfterPushes<DoublingGrowth>(9) == 16);
+    assert(CapacityAfterPushes<OneAndHalfGrowth>(9) == 9);
+    assert(CapacityAfterPushes<OneAndHalfGrowth>(10) == 13);
+    assert(CapacityAfterPushes<FixedStepGrowth<8>>(9) == 16);
+    assert(CapacityAfterPushes<FixedStepGrowth<8>>(17) == 24);
+    assert(GoldenRatioGrowth::next_capacity(1000, 1001, sizeof(int)) == 1618);
+    assert((RoundUpGrowth<4096>::next_capacity(0, 1, sizeof(int)) == 1024));
+    assert((RoundUpGrowth<64, OneAndHalfGrowth>::next_capacity(10, 11, 24) == 16));
+    assert(DoublingGrowth::next_capacity(std::numeric_limits<size_t>::max() - 1, std::numeric_limits<size_t>::max(), 1)
+        == std::numeric_limits<size_t>::max());
+
+    {
+        SimpleVector<int, std::allocator<int>, RoundUpGrowth<4096>> v{ 1, 2, 3 };
+
+        v.insert(v.begin(), 0);
+
+        assert(v.get_capacity() == 1024);
+
+        v.resize(2000);
+
+        assert(v.get_capacity() == 2048);
+        assert(v[0] == 0 && v[3] == 3 && v[1999] == 0);
+
+        //    max_size    ,   
+        try
+        {
+            v.resize(v.max_size() + 1);
+            assert(false);
+        }
+        catch (const std::length_error&)
+        {
+        }
+        assert(v.get_size() == 2000);
+    }
+
+    {
+        SmallSimpleVector<int, 2, std::allocator<int>, FixedStepGrowth<3>> v{ 1, 2 };
+
+        v.push_back(3);
+
+        assert(v.get_capacity() == 5);
+    }
+}
+
+inline void Test10()
+{
+    static_assert(ArrayPtr<int, MmapAllocator<int>>::can_reallocate);
+
+    {
+        SimpleVector<int, MmapAllocator<int, 4096>> v;
+
+        for (int i = 0; i < 1000000; ++i)
+        {
+            v.push_back(i);
+        }
+
+        v.insert(v.begin(), -1);
+        v.shrink_to_fit();
+
+        assert(v.get_size() == 1000001 && v.get_capacity() == 1000001);
+        assert(v[0] == -1 && v[1] == 0 && v[1000000] == 999999);
+
+        v.resize(10);
+        v.shrink_to_fit();
+
+        assert(v[9] == 8);
+    }
+
+    {
+        SimpleVector<int64_t, MmapAllocator<int64_t, 4096, HugePages::Explicit2M>> v(100000, 7);
+
+        v.resize(500000);
+
+        assert(v[99999] == 7 && v[100000] == 0);
+    }
+
+    {
+        SimpleVector<std::string, MmapAllocator<std::string, 4096, HugePages::Off>> v;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            v.push_back(std::to_string(i));
+        }
+
+        assert(v[999] == "999"s);
+    }
+}
+
+inline void Test11()
+{
+    struct Point
+    {
+        int32_t x;
+        int32_t y;
+    };
+
+    const std::string path = (std::filesystem::temp_directory_path() / "simple_vector_mapped_test.bin").string();
+    std::filesystem::remove(path);
+
+    {
+        MappedSimpleVector<Point> v(path);
+
+        assert(v.is_empty());
+
+        for (int32_t i = 0; i < 10000; ++i)
+        {
+            v.push_back({ i, -i });
+        }
+        v.push_back(v[0]);
+        v.sync();
+
+        assert(v.get_size() == 10001);
+        assert(v.get_capacity() >= v.get_size());
+    }
+
+    {
+        MappedSimpleVector<Point> v(path);
+
+        assert(v.get_size() == 10001);
+        assert(v[9999].x == 9999 && v[9999].y == -9999);
+        assert(v.back().x == 0);
+
+        int64_t sum = 0;
+        for (const Point& point : v)
+        {
+            sum += point.x;
+        }
+        assert(sum == 9999LL * 10000 / 2);
+
+        v.resize(20000);
+
+        assert(v[15000].x == 0);
+
+        v.pop_back();
+        v.clear();
+
+        assert(v.is_empty());
+
+        //     
+        MappedSimpleVector<Point> moved = std::move(v);
+        assert(v.is_empty() && v.get_capacity() == 0 && v.begin() == v.end() && moved.get_capacity() >= 20000);
+
+        try
+        {
+            moved.reserve(std::numeric_limits<size_t>::max() / sizeof(Point));
+            assert(false);
+        }
+        catch (const std::length_error&)
+        {
+        }
+    }
+
+    try
+    {
+        MappedSimpleVector<int32_t> wrong_type(path);
+        assert(false);
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+
+    std::filesystem::remove(path);
+}
+
+inline void Test12()
+{
+    ThreadPool pool(4);
+
+    assert(pool.get_size() == 4);
+
+    {
+        const size_t size = 100000;
+        SimpleVector<int> v;
+
+        parallel_assign(v, size, 3, pool);
+
+        assert(v.get_size() == size);
+        assert(std::all_of(v.begin(), v.end(), [](int x) { return x == 3; }));
+
+        parallel_fill(v, 1, pool);
+        parallel_transform(v, v, [](int x) { return x * 2; }, pool);
+
+        assert(parallel_reduce(v, int64_t(0), std::plus<>(), pool) == 2 * int64_t(size));
+
+        std::iota(v.begin(), v.end(), 0);
+        std::reverse(v.begin(), v.end());
+        parallel_sort(v, std::less<>(), pool);
+
+        assert(std::is_sorted(v.begin(), v.end()));
+        assert(v.front() == 0 && v.back() == int(size) - 1);
+
+        SimpleVector<int> copy;
+        parallel_copy(v, copy, pool);
+
+        assert(copy == v);
+    }
+
+    {
+        SimpleVector<std::string> v;
+
+        parallel_assign(v, 10000, "value"s, pool);
+        parallel_sort(v, std::greater<>(), pool);
+
+        assert(v.get_size() == 10000 && v[9999] == "value"s);
+        assert(parallel_reduce(SimpleVector<int>{}, 5, std::plus<>(), pool) == 5);
+
+        //          
+        v[0] = std::string(100, 'x');
+        parallel_assign(v, 20000, v[0], pool);
+        assert(v.get_size() == 20000 && v[19999] == std::string(100, 'x'));
+        parallel_copy(v, v, pool);
+        assert(v.get_size() == 20000 && v[0] == std::string(100, 'x') && v[19999] == v[0]);
+    }
+
+    {
+        //    ,  pmr-   
+        std::pmr::synchronized_pool_resource resource;
+        SimpleVector<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>> v(&resource);
+
+        parallel_assign(v, 10000, std::pmr::string(100, 'p'), pool);
+        assert(std::all_of(v.begin(), v.end(), [&](const std::pmr::string& item) { return item.get_allocator().resource() == &resource; }));
+
+        SimpleVector<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>> copy(&resource);
+        parallel_copy(v, copy, pool);
+        assert(copy == v && copy[9999].get_allocator().resource() == &resource);
+    }
+
+    {
+        SimpleVector<int> v(100000, 1);
+
+        try
+        {
+            pool.run(v.get_size(), [](size_t first, size_t)
+            {
+                if (first > 0)
+                {
+                    throw std::runtime_error("chunk failed");
+                }
+            });
+            assert(false);
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+    }
+}
+
+//     ,    
+template <typename Type>
+void CheckSimdAlgorithms()
+{
+    for (size_t size : { 0, 1, 7, 16, 31, 33, 64, 257, 1000 })
+    {
+        SimpleVector<Type> v(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            v[i] = static_cast<Type>((i * 37) % 101);
+        }
+
+        for (Type value : { Type(0), Type(5), Type(100), Type(102) })
+        {
+            assert(simd_find(v, value) == std::find(v.cbegin(), v.cend(), value));
+            assert(simd_count(v, value) == static_cast<size_t>(std::count(v.begin(), v.end(), value)));
+        }
+
+        assert(simd_min_element(v) == std::min_element(v.cbegin(), v.cend()));
+        assert(simd_max_element(v) == std::max_element(v.cbegin(), v.cend()));
+
+        SimpleVector<Type> copy(v);
+
+        assert(copy == v && !(copy < v) && !(v < copy));
+
+        for (size_t i = 0; i < size; i += 13)
+        {
+            copy[i] = static_cast<Type>(copy[i] + 1);
+
+            assert(copy != v);
+            assert((v < copy) == std::lexicographical_compare(v.begin(), v.end(), copy.begin(), copy.end()));
+            assert((copy < v) == std::lexicographical_compare(copy.begin(), copy.end(), v.begin(), v.end()));
+
+            copy[i] = v[i];
+        }
+
+        copy.push_back(Type(0));
+
+        assert(v < copy && v != copy);
+    }
+}
+
+inline void Test13()
+{
+    CheckSimdAlgorithms<int8_t>();
+    CheckSimdAlgorithms<uint8_t>();
+    CheckSimdAlgorithms<int16_t>();
+    CheckSimdAlgorithms<uint32_t>();
+    CheckSimdAlgorithms<int32_t>();
+    CheckSimdAlgorithms<int64_t>();
+    CheckSimdAlgorithms<double>();
+
+    {
+        SimpleVector<int32_t> v{ -5, 7, -9, 3 };
+
+        assert(*simd_min_element(v) == -9 && *simd_max_element(v) == 7);
+        assert((SimpleVector<uint16_t>{ 0x0100 } < SimpleVector<uint16_t>{ 0x00FF }) == false);
+        assert((SimpleVector<int32_t>{ -1 } < SimpleVector<int32_t>{ 1 }));
+    }
+
+    {
+        //    :  int     
+        SimpleVector<int64_t> wide{ 1, 2, 3, 2 };
+        assert(simd_find(wide, 2) == wide.cbegin() + 1 && simd_count(wide, 2) == 2);
+
+        SimpleVector<uint8_t> bytes{ 0, 44, 255, 44 };
+        assert(simd_count(bytes, 44) == 2 && simd_find(bytes, 255) == bytes.cbegin() + 2);
+        assert(simd_count(bytes, 300) == 0 && simd_find(bytes, -1) == bytes.cend());
+
+        SimpleVector<int32_t> negative{ -1, 5 };
+        assert(simd_find(negative, 0xFFFFFFFFu) == negative.cend() && simd_count(negative, int64_t(-1)) == 1);
+    }
+}
+
+//  :       SIMPLE_VECTOR_STATS
+inline void Test14()
+{
+    VectorStatsRegistry::reset();
+
+    {
+        VECTOR_STATS_TAG("test14");
+
+        {
+            SimpleVector<string> v;
+            const string value = "value";
+
+            for (int i = 0; i < 5; ++i)
+            {
+                v.push_back(value);
+            }
+            v.insert(v.begin(), value);
+            v.erase(v.begin());
+        }
+        {
+            VECTOR_STATS_TAG("test14-nested");
+
+            SimpleVector<int> v(4);
+            v.reserve(16);
+        }
+        {
+            SimpleVector<int> v{ 1, 2, 3 };
+        }
+    }
+
+    ostringstream report;
+    VectorStatsRegistry::report(report);
+    assert(!report.str().empty());
+
+#if defined(SIMPLE_VECTOR_STATS)
+    VectorStatsCounters& strings = VectorStatsRegistry::get("test14");
+
+    // :  1, 2, 4, 8,         ;
+    //    int         "test14"
+    assert(strings.allocations == 4 + 1);
+    assert(strings.reallocations == 3);
+    assert(strings.copied == 5 + 3);
+    assert(strings.moved == 1 + 2 + 4 + 6 + 5);
+    assert(strings.relocated == 0);
+    assert(strings.peak_capacity_bytes == 8 * sizeof(string));
+    assert(strings.wasted_bytes == 3 * sizeof(string));
+
+    VectorStatsCounters& ints = VectorStatsRegistry::get("test14-nested");
+
+    assert(ints.allocations == 2);
+    assert(ints.reallocations == 1);
+    assert(ints.relocated == 4);
+    assert(ints.wasted_bytes == 12 * sizeof(int));
+    assert(ints.peak_wasted_bytes == 12 * sizeof(int));
+    assert(report.str().find("test14-nested") != string::npos);
+#endif
+}
+
+//   TrackingAllocator    
+inline void Test15()
+{
+    AllocationTracker& tracker = AllocationTracker::instance();
+    const size_t live = tracker.get_live_count();
+
+    {
+        SimpleVector<int, TrackingAllocator<int>> v{ TrackingAllocator<int>("test15") };
+        tracker.reset_peak();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            v.push_back(i);
+        }
+
+        assert(v.get_allocator().get_tag() == string("test15"));
+        assert(tracker.get_live_count() == live + 1);
+        assert(tracker.get_peak_bytes() >= tracker.get_live_bytes() + 64 * sizeof(int));
+
+        SimpleVector<int, TrackingAllocator<int>> copy(v);
+        assert(copy.get_allocator().get_tag() == string("test15"));
+        assert(tracker.get_live_count() == live + 2);
+    }
+    assert(tracker.get_live_count() == live);
+
+    {
+        ALLOCATION_TAG("test15-leak");
+
+        TrackingAllocator<int> alloc;
+        int* leaked = alloc.allocate(10);
+
+        ostringstream report;
+        assert(tracker.report_leaks(report) == live + 1);
+        assert(report.str().find("test15-leak: 1 blocks, "s + to_string(10 * sizeof(int)) + " bytes") != string::npos);
+
+        alloc.deallocate(leaked, 10);
+    }
+    assert(tracker.get_live_count() == live);
+
+    {
+        //       ,  
+        TrackingAllocator<int> alloc("test15-before");
+        int* before = alloc.allocate(4);
+
+        const size_t since = tracker.get_total_allocations();
+        TrackingAllocator<int> later("test15-after");
+        int* after = later.allocate(2);
+
+        ostringstream report;
+        assert(tracker.get_live_count(since) == 1 && tracker.get_live_count() == live + 2);
+        assert(tracker.report_leaks(report, since) == 1);
+        assert(report.str().find("test15-before") == string::npos);
+        assert(report.str().find("1 blocks, "s + to_string(2 * sizeof(int)) + " bytes") != string::npos);
+
+        later.deallocate(after, 2);
+        ostringstream empty;
+        assert(tracker.report_leaks(empty, since) == 0 && empty.str().empty());
+
+        alloc.deallocate(before, 4);
+    }
+    assert(tracker.get_live_count() == live);
+    assert(tracker.get_unknown_deallocations() == 0);
+}
+
+// :   ,  , 
+inline void Test16()
+{
+    Profiler& profiler = Profiler::instance();
+
+    {
+        size_t site = profiler.site_index("test16-values");
+        assert(profiler.site_index("test16-values") == site);
+
+        for (uint64_t value = 1; value <= 1000; ++value)
+        {
+            profiler.record(site, value);
+        }
+    }
+    {
+        SimpleVector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([]
+            {
+                for (int i = 0; i < 100; ++i)
+                {
+                    LOG_DURATION("test16-scope");
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    auto find = [](const SimpleVector<ProfileSummary>& summaries, const string& id)
+    {
+        return *std::find_if(summaries.begin(), summaries.end(), [&](const ProfileSummary& summary) { return summary.id == id; });
+    };
+
+    SimpleVector<ProfileSummary> summaries;
+    for (ProfileSummary& summary : profiler.summarize())
+    {
+        summaries.push_back(std::move(summary));
+    }
+
+    ProfileSummary values = find(summaries, "test16-values");
+    assert(values.count == 1000 && values.total_ns == 500500);
+    assert(values.min_ns == 1 && values.max_ns == 1000);
+    assert(values.p50_ns >= 500 * 31 / 32 && values.p50_ns <= 500 * 33 / 32);
+    assert(values.p99_ns >= 990 * 31 / 32 && values.p99_ns <= 1000);
+    assert(values.p999_ns >= 999 * 31 / 32 && values.p999_ns <= 1000);
+
+    assert(find(summaries, "test16-scope").count == 400);
+
+    //              
+    for (int i = 0; i < 6; ++i)
+    {
+        LOG_DURATION_DYNAMIC(i % 2 ? "test16-odd"s : "test16-even"s);
+    }
+    summaries.clear();
+    for (ProfileSummary& summary : profiler.summarize())
+    {
+        summaries.push_back(std::move(summary));
+    }
+    assert(find(summaries, "test16-odd").count == 3 && find(summaries, "test16-even").count == 3);
+
+    for (uint64_t value : { uint64_t(0), uint64_t(31), uint64_t(32), uint64_t(1000), uint64_t(123456789), UINT64_MAX })
+    {
+        size_t index = ProfileHistogram::bucket_index(value);
+        assert(index < ProfileHistogram::kBuckets);
+        assert(ProfileHistogram::bucket_lower(index) <= value);
+        assert(value - ProfileHistogram::bucket_lower(index) < ProfileHistogram::bucket_width(index));
+    }
+
+    ostringstream text;
+    profiler.report(text);
+    assert(text.str().find("test16-scope") != string::npos);
+
+    ostringstream json;
+    profiler.report_json(json);
+    assert(json.str().find("{\"id\": \"test16-values\", \"count\": 1000, \"total_ns\": 500500, \"min_ns\": 1") != string::npos);
+
+    profiler.reset();
+    assert(profiler.summarize().empty());
+}
+
+//      ,    copy_budget  
+class ThrowingCopy
+{
+public:
+    explicit ThrowingCopy(int value) : value(value)
+    {
+        ++alive;
+    }
+
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+    {
+        if (copy_budget == 0)
+        {
+            throw runtime_error("copy failed");
+        }
+        if (copy_budget > 0)
+        {
+            --copy_budget;
+        }
+        ++alive;
+        ++copies;
+    }
+
+    ThrowingCopy(ThrowingCopy&& other) : value(other.value)
+    {
+        ++alive;
+        ++moves;
+    }
+
+    ThrowingCopy& operator=(const ThrowingCopy& other) = default;
+    ThrowingCopy& operator=(ThrowingCopy&& other) = default;
+
+    ~ThrowingCopy()
+    {
+        --alive;
+    }
+
+    int get_value() const
+    {
+        return value;
+    }
+
+    inline static int alive = 0;
+    inline static int copies = 0;
+    inline static int moves = 0;
+    inline static int copy_budget = -1;
+
+private:
+    int value;
+};
+
+//    ,  
+class NoexceptMove
+{
+public:
+    explicit NoexceptMove(int value) : value(value) {}
+
+    NoexceptMove(const NoexceptMove& other) : value(other.value)
+    {
+        ++copies;
+    }
+
+    NoexceptMove(NoexceptMove&& other) noexcept = default;
+    NoexceptMove& operator=(const NoexceptMove& other) = default;
+    NoexceptMove& operator=(NoexceptMove&& other) noexcept = default;
+
+    inline static int copies = 0;
+
+private:
+    int value;
+};
+
+// ,      ThrowingCopy   0..3   
+template <typename Vector>
+void CheckStrongGrowth(Vector& v, void (*grow)(Vector&))
+{
+    ThrowingCopy::copy_budget = 2;
+    try
+    {
+        grow(v);
+        assert(false);
+    }
+    catch (const runtime_error&)
+    {
+    }
+    ThrowingCopy::copy_budget = -1;
+
+    assert(v.get_size() == 4 && v.get_capacity() == 4);
+    for (int i = 0; i < 4; ++i)
+    {
+        assert(v[i].get_value() == i);
+    }
+    assert(ThrowingCopy::alive == 4);
+}
+
+//   move_if_noexcept   
+inline void Test17()
+{
+    {
+        SimpleVector<ThrowingCopy> v;
+        for (int i = 0; i < 4; ++i)
+        {
+            v.push_back(ThrowingCopy(i));
+        }
+
+        //   ,    1 -> 2 -> 4   
+        assert(ThrowingCopy::moves == 4);
+        assert(ThrowingCopy::copies == 1 + 2);
+        assert(v.get_capacity() == 4);
+
+        CheckStrongGrowth<SimpleVector<ThrowingCopy>>(v, [](SimpleVector<ThrowingCopy>& vector) { vector.emplace_back(9); });
+        CheckStrongGrowth<SimpleVector<ThrowingCopy>>(v, [](SimpleVector<ThrowingCopy>& vector) { vector.emplace(vector.begin() + 2, 9); });
+        CheckStrongGrowth<SimpleVector<ThrowingCopy>>(v, [](SimpleVector<ThrowingCopy>& vector) { vector.reserve(100); });
+    }
+    assert(ThrowingCopy::alive == 0);
+
+    {
+        SmallSimpleVector<ThrowingCopy, 2> v;
+        for (int i = 0; i < 4; ++i)
+        {
+            v.emplace_back(i);
+        }
+
+        CheckStrongGrowth<SmallSimpleVector<ThrowingCopy, 2>>(v, [](SmallSimpleVector<ThrowingCopy, 2>& vector) { vector.emplace_back(9); });
+        CheckStrongGrowth<SmallSimpleVector<ThrowingCopy, 2>>(v, [](SmallSimpleVector<ThrowingCopy, 2>& vector) { vector.emplace(vector.begin() + 1, 9); });
+    }
+    assert(ThrowingCopy::alive == 0);
+
+    {
+        SimpleVector<NoexceptMove> v;
+        for (int i = 0; i < 100; ++i)
+        {
+            v.emplace_back(i);
+        }
+        v.insert(v.begin() + 50, NoexceptMove(-1));
+        v.reserve(1000);
+
+        assert(NoexceptMove::copies == 0);
+    }
+}
+
+//  :  , std::ranges,    
+inline void Test18()
+{
+    {
+        istringstream input("1 2 3 4 5 6 7 8 9 10");
+        SimpleVector<int> v{ 0 };
+
+        v.append_range(istream_iterator<int>(input), istream_iterator<int>());
+        assert(v.get_size() == 11);
+        for (int i = 0; i <= 10; ++i)
+        {
+            assert(v[i] == i);
+        }
+    }
+    {
+        SimpleVector<int> v;
+        v.append_range(std::views::iota(0, 100) | std::views::filter([](int x) { return x % 2 == 0; }));
+        assert(v.get_size() == 50 && v[49] == 98);
+
+        v.append_range(std::views::iota(0, 10));
+        assert(v.get_size() == 60 && v.back() == 9);
+
+        const int array[] = { 7, 8 };
+        v.append_range(array);
+        assert(v.get_size() == 62 && v.back() == 8);
+    }
+    {
+        SimpleVector<Counted> v(reserve(4));
+        for (int i = 0; i < 3; ++i)
+        {
+            v.push_back(Counted(i));
+        }
+        SimpleVector<Counted> source(reserve(8));
+        for (int i = 3; i < 6; ++i)
+        {
+            source.push_back(Counted(i));
+        }
+
+        v.append_range(std::move(source));
+        assert(source.is_empty());
+        assert(v.get_size() == 6 && v[5].get_value() == 5);
+        assert(Counted::alive == 6);
+
+        SimpleVector<Counted> empty;
+        empty.append_range(std::move(v));
+        assert(v.is_empty() && empty.get_size() == 6);
+        assert(Counted::alive == 6);
+    }
+    assert(Counted::alive == 0);
+    {
+        SimpleVector<string> v{ "a"s };
+        SimpleVector<string> source{ "b"s, "c"s };
+
+        v.append_range(std::move(source));
+        assert(source.is_empty() && v.get_size() == 3 && v[2] == "c"s);
+
+        SimpleVector<string> copy;
+        copy.append_range(v);
+        assert(copy == v);
+    }
+}
+
+//    
+inline void Test19()
+{
+    auto check = [](const SimpleVector<int>& v, std::initializer_list<int> expected)
+    {
+        return v == SimpleVector<int>(expected);
+    };
+
+    {
+        SimpleVector<int> v{ 1, 2, 3, 4, 5 };
+        v.reserve(20);
+
+        //   
+        auto it = v.insert(v.begin() + 1, { 10, 11 });
+        assert(it == v.begin() + 1);
+        assert(check(v, { 1, 10, 11, 2, 3, 4, 5 }));
+
+        //   
+        const int array[] = { 20, 21, 22, 23 };
+        v.insert(v.end() - 1, std::begin(array), std::end(array));
+        assert(check(v, { 1, 10, 11, 2, 3, 4, 20, 21, 22, 23, 5 }));
+        assert(v.get_capacity() == 20);
+
+        //    
+        v.insert(v.begin(), 2, v[10]);
+        assert(check(v, { 5, 5, 1, 10, 11, 2, 3, 4, 20, 21, 22, 23, 5 }));
+        v.insert(v.begin() + 12, 5, v[2]);
+        assert(check(v, { 5, 5, 1, 10, 11, 2, 3, 4, 20, 21, 22, 23, 1, 1, 1, 1, 1, 5 }));
+
+        //  
+        v.insert(v.begin() + 3, 3, 0);
+        assert(v.get_size() == 21 && v.get_capacity() > 20);
+        assert(check(v, { 5, 5, 1, 0, 0, 0, 10, 11, 2, 3, 4, 20, 21, 22, 23, 1, 1, 1, 1, 1, 5 }));
+
+        it = v.erase(v.begin() + 3, v.begin() + 6);
+        assert(*it == 10);
+        assert(check(v, { 5, 5, 1, 10, 11, 2, 3, 4, 20, 21, 22, 23, 1, 1, 1, 1, 1, 5 }));
+
+        v.erase(v.begin() + 12, v.end());
+        v.erase(v.begin(), v.begin());
+        assert(check(v, { 5, 5, 1, 10, 11, 2, 3, 4, 20, 21, 22, 23 }));
+
+        istringstream input("7 8 9");
+        v.insert(v.begin() + 2, istream_iterator<int>(input), istream_iterator<int>());
+        assert(check(v, { 5, 5, 7, 8, 9, 1, 10, 11, 2, 3, 4, 20, 21, 22, 23 }));
+
+        v.erase(v.begin(), v.end());
+        assert(v.is_empty());
+    }
+    {
+        SimpleVector<Counted> v;
+        for (int i = 0; i < 6; ++i)
+        {
+            v.push_back(Counted(i));
+        }
+        v.insert(v.begin() + 2, 4, Counted(-1));
+        assert(Counted::alive == 10);
+        v.erase(v.begin() + 1, v.begin() + 7);
+        assert(Counted::alive == 4);
+        assert(v[0].get_value() == 0 && v[1].get_value() == 3 && v[3].get_value() == 5);
+
+        ThrowingCopy::copy_budget = -1;
+        SimpleVector<ThrowingCopy> throwing;
+        throwing.reserve(4);
+        for (int i = 0; i < 4; ++i)
+        {
+            throwing.emplace_back(i);
+        }
+        CheckStrongGrowth<SimpleVector<ThrowingCopy>>(throwing,
+            [](SimpleVector<ThrowingCopy>& vector) { vector.insert(vector.begin() + 1, 2, ThrowingCopy(9)); });
+    }
+    assert(Counted::alive == 0);
+    assert(ThrowingCopy::alive == 0);
+
+    {
+        //     :       
+        SimpleVector<std::string> words{ "alpha"s, "beta"s, "gamma"s };
+        auto it = words.erase(words.cbegin() + 1, words.cbegin() + 1);
+        assert(it == words.begin() + 1 && words.get_size() == 3);
+        assert(words[0] == "alpha"s && words[1] == "beta"s && words[2] == "gamma"s);
+        words.erase(words.cend(), words.cend());
+        assert(words.get_size() == 3 && words[2] == "gamma"s);
+    }
+}
+
+//        
+inline void Test20()
+{
+    {
+        SimpleVector<int> v{ 0, 1, 2, 3, 4 };
+
+        auto it = v.unordered_erase(v.begin() + 1);
+        assert(*it == 4);
+        assert((v == SimpleVector<int>{ 0, 4, 2, 3 }));
+
+        it = v.unordered_erase(v.end() - 1);
+        assert(it == v.end());
+        assert((v == SimpleVector<int>{ 0, 4, 2 }));
+    }
+    {
+        SimpleVector<int> v(1000);
+        std::iota(v.begin(), v.end(), 0);
+
+        assert(v.erase_if([](int x) { return x % 3 != 0; }) == 666);
+        assert(v.get_size() == 334);
+        for (size_t i = 0; i < v.get_size(); ++i)
+        {
+            assert(v[i] == static_cast<int>(i) * 3);
+        }
+        assert(v.erase_if([](int) { return false; }) == 0);
+    }
+    {
+        SimpleVector<Counted> v;
+        for (int i = 0; i < 10; ++i)
+        {
+            v.push_back(Counted(i));
+        }
+
+        v.unordered_erase(v.begin());
+        assert(Counted::alive == 9 && v[0].get_value() == 9);
+
+        assert(v.erase_if([](const Counted& c) { return c.get_value() < 5; }) == 4);
+        assert(Counted::alive == 5 && v[0].get_value() == 9 && v[1].get_value() == 5);
+    }
+    assert(Counted::alive == 0);
+}
+
+//    AtomicCountingAllocator,      rebind
+inline std::atomic<size_t> atomic_counting_allocations{ 0 };
+
+// ,       
+template <typename Type>
+class AtomicCountingAllocator
+{
+public:
+    using value_type = Type;
+
+    AtomicCountingAllocator() = default;
+
+    template <typename Other>
+    AtomicCountingAllocator(const AtomicCountingAllocator<Other>&) noexcept {}
+
+    Type* allocate(size_t count)
+    {
+        atomic_counting_allocations.fetch_add(1, std::memory_order_relaxed);
+        return std::allocator<Type>().allocate(count);
+    }
+
+    void deallocate(Type* ptr, size_t count) noexcept
+    {
+        std::allocator<Type>().deallocate(ptr, count);
+    }
+
+    bool operator==(const AtomicCountingAllocator&) const noexcept
+    {
+        return true;
+    }
+};
+
+//         
+inline void Test21()
+{
+    const size_t thread_count = 8;
+    const size_t per_thread = 20000;
+
+    ConcurrentSimpleVector<size_t> v;
+    size_t first_index = v.push_back(size_t(-1));
+    const size_t* first = &v[first_index];
+
+    std::atomic<bool> done = false;
+    std::thread reader([&]
+    {
+        while (!done.load())
+        {
+            size_t size = v.get_size();
+            for (size_t i = 1; i < size; i += 97)
+            {
+                if (const size_t* value = v.try_get(i))
+                {
+                    assert(*value / per_thread < thread_count);
+                }
+            }
+        }
+    });
+
+    SimpleVector<std::thread> writers;
+    for (size_t t = 0; t < thread_count; ++t)
+    {
+        writers.emplace_back([&v, t, per_thread]
+        {
+            for (size_t i = 0; i < per_thread; ++i)
+            {
+                v.push_back(t * per_thread + i);
+            }
+        });
+    }
+    for (std::thread& writer : writers)
+    {
+        writer.join();
+    }
+    done = true;
+    reader.join();
+
+    assert(v.get_size() == thread_count * per_thread + 1);
+    assert(&v[first_index] == first && *first == size_t(-1));
+    assert(v.is_published(thread_count * per_thread));
+    assert(!v.is_published(thread_count * per_thread + 1));
+
+    SimpleVector<size_t> frozen = v.freeze();
+    assert(v.get_size() == 0);
+    assert(frozen.get_size() == thread_count * per_thread + 1);
+
+    std::sort(frozen.begin(), frozen.end());
+    for (size_t i = 0; i < thread_count * per_thread; ++i)
+    {
+        assert(frozen[i] == i);
+    }
+
+    {
+        ConcurrentSimpleVector<ThrowingCopy> throwing;
+        ThrowingCopy value(1);
+
+        throwing.push_back(value);
+        ThrowingCopy::copy_budget = 0;
+        try
+        {
+            throwing.push_back(value);
+            assert(false);
+        }
+        catch (const runtime_error&)
+        {
+        }
+        ThrowingCopy::copy_budget = -1;
+        throwing.push_back(value);
+
+        assert(throwing.get_size() == 3 && !throwing.is_published(1));
+        try
+        {
+            throwing.at(1);
+            assert(false);
+        }
+        catch (const out_of_range&)
+        {
+        }
+
+        SimpleVector<ThrowingCopy> result = throwing.freeze();
+        assert(result.get_size() == 2);
+    }
+    assert(ThrowingCopy::alive == 0);
+
+    {
+        //         
+        ConcurrentSimpleVector<size_t, AtomicCountingAllocator<size_t>> counted;
+        std::atomic<bool> start = false;
+
+        SimpleVector<std::thread> pushers;
+        for (size_t t = 0; t < thread_count; ++t)
+        {
+            pushers.emplace_back([&counted, &start, per_thread]
+            {
+                while (!start.load())
+                {
+                }
+                for (size_t i = 0; i < per_thread; ++i)
+                {
+                    counted.push_back(i);
+                }
+            });
+        }
+        start = true;
+        for (std::thread& pusher : pushers)
+        {
+            pusher.join();
+        }
+
+        size_t segments = 0;
+        while (((size_t(1) << segments) - 1) * 32 < counted.get_size())
+        {
+            ++segments;
+        }
+        assert(atomic_counting_allocations.load() == segments);
+    }
+}
+
+//    : -, , , ,   simd  parallel 
+inline void Test22()
+{
+    using Records = SoAVector<int, double, string>;
+    static_assert(std::ranges::random_access_range<Records>);
+    static_assert(std::sortable<Records::Iterator>);
+
+    {
+        Records v{ { 3, 0.5, "c" }, { 1, 1.5, "a" } };
+        v.push_back({ 2, 2.5, "b" });
+        v.emplace_back(4, 3.5, "d");
+
+        assert(v.get_size() == 4 && v.get_capacity() == 4);
+        assert(v.front() == std::make_tuple(3, 0.5, string("c")));
+        assert(v.back() == std::make_tuple(4, 3.5, string("d")));
+
+        //   -   
+        auto [id, score, name] = v[1];
+        id = 10;
+        name += "!";
+        assert(v.data<0>()[1] == 10 && v.column<2>()[1] == "a!");
+        v[1] = std::make_tuple(1, 1.5, string("a"));
+
+        std::sort(v.begin(), v.end(), [](const auto& lhs, const auto& rhs) { return get<0>(lhs) < get<0>(rhs); });
+        for (int i = 0; i < 4; ++i)
+        {
+            assert(v[i].get<0>() == i + 1);
+            assert(v[i].get<2>() == string(1, static_cast<char>('a' + i)));
+        }
+
+        //      
+        assert(simd_count(v.column<0>(), 3) == 1);
+        assert(*simd_max_element(v.column<0>()) == 4);
+        assert(parallel_reduce(v.column<1>(), 0.0, std::plus<>()) == 8.0);
+
+        auto it = v.insert(v.begin() + 1, std::make_tuple(7, 7.5, string("x")));
+        assert(it == v.begin() + 1 && v.get_size() == 5);
+        v.emplace(v.begin(), 8, 8.5, "y");
+        v.emplace(v.begin() + 3, 9, 9.5, "z");
+        assert(v.get_size() == 7);
+        const int order[] = { 8, 1, 7, 9, 2, 3, 4 };
+        for (size_t i = 0; i < v.get_size(); ++i)
+        {
+            assert(v[i].get<0>() == order[i]);
+        }
+
+        //        
+        it = v.erase(v.begin() + 1, v.begin() + 1);
+        assert(it == v.begin() + 1 && v.get_size() == 7);
+        assert(v[1].get<2>() == string("a") && v[2].get<2>() == string("x") && v[6].get<2>() == string("d"));
+
+        it = v.erase(v.begin() + 1, v.begin() + 3);
+        assert((*it).get<0>() == 9 && v.get_size() == 5);
+        it = v.erase(v.begin());
+        assert((*it).get<0>() == 9);
+        it = v.unordered_erase(v.begin());
+        assert(v[0].get<0>() == 4 && v.get_size() == 3);
+
+        assert(v.erase_if([](const auto& row) { return row.template get<1>() > 1.0; }) == 2);
+        assert(v.get_size() == 1 && v[0] == std::make_tuple(3, 0.5, string("c")));
+
+        Records copy = v;
+        assert(copy == v);
+        copy.resize(3);
+        assert(copy != v && copy[2] == std::make_tuple(0, 0.0, string()));
+        copy.pop_back();
+        copy.shrink_to_fit();
+        assert(copy.get_capacity() == 2);
+
+        Records moved = std::move(copy);
+        assert(moved.get_size() == 2 && copy.is_empty());
+        copy = moved;
+        assert(copy == moved);
+    }
+
+    {
+        Records v(100, std::make_tuple(1, 2.0, string("value")));
+        int sum = 0;
+        for (auto [id, score, name] : v)
+        {
+            sum += id;
+            assert(score == 2.0 && name == "value");
+        }
+        assert(sum == 100);
+
+        const Records& cv = v;
+        for (Records::ConstIterator it = cv.begin(); it != cv.end(); ++it)
+        {
+            assert(get<1>(*it) == 2.0);
+        }
+        try
+        {
+            cv.at(100);
+            assert(false);
+        }
+        catch (const out_of_range&)
+        {
+        }
+    }
+
+    {
+        //    :    ,    
+        SoAVector<int, ThrowingCopy> v;
+        for (int i = 0; i < 4; ++i)
+        {
+            v.emplace_back(i, ThrowingCopy(i));
+        }
+
+        ThrowingCopy::copy_budget = 2;
+        try
+        {
+            v.emplace(v.begin() + 1, 9, ThrowingCopy(9));
+            assert(false);
+        }
+        catch (const runtime_error&)
+        {
+        }
+        ThrowingCopy::copy_budget = -1;
+
+        assert(v.get_size() == 4 && v.get_capacity() == 4);
+        for (int i = 0; i < 4; ++i)
+        {
+            assert(v[i].get<0>() == i && v[i].get<1>().get_value() == i);
+        }
+        assert(ThrowingCopy::alive == 4);
+    }
+    assert(ThrowingCopy::alive == 0);
+}
+
+//    :  , ,  ,     
+inline void Test23()
+{
+    {
+        SimpleVector<int> v(1000);
+        std::iota(v.begin(), v.end(), -500);
+
+        std::stringstream buffer;
+        write_binary(buffer, v);
+        assert(buffer.str().size() == binary_size(v) && binary_size(v) == sizeof(BinaryVectorHeader) + 1000 * sizeof(int));
+
+        SimpleVector<int> read = read_binary<SimpleVector<int>>(buffer);
+        assert(read == v && read.get_capacity() == 1000);
+
+        //      
+        SimpleVector<uint64_t> storage(binary_size(v) / sizeof(uint64_t) + 1);
+        std::string bytes = buffer.str();
+        std::memcpy(storage.data(), bytes.data(), bytes.size());
+
+        std::span<const int> view = view_binary<int>(storage.data(), bytes.size());
+        assert(view.size() == 1000 && view.front() == -500 && view.back() == 499);
+        assert(static_cast<const void*>(view.data()) == reinterpret_cast<const char*>(storage.data()) + sizeof(BinaryVectorHeader));
+
+        try
+        {
+            view_binary<int>(storage.data(), bytes.size() - 1);
+            assert(false);
+        }
+        catch (const runtime_error&)
+        {
+        }
+        try
+        {
+            view_binary<double>(storage.data(), bytes.size());
+            assert(false);
+        }
+        catch (const runtime_error&)
+        {
+        }
+    }
+
+    {
+        SimpleVector<string> words{ "", "alpha", string(100, 'x'), "gamma" };
+        SimpleVector<SimpleVector<string>> nested{ words, {}, { "one" } };
+
+        std::stringstream buffer;
+        write_binary(buffer, words);
+        write_binary(buffer, nested);
+        assert(buffer.str().size() == binary_size(words) + binary_size(nested));
+
+        assert(read_binary<SimpleVector<string>>(buffer) == words);
+        SimpleVector<SimpleVector<string>> read = read_binary<SimpleVector<SimpleVector<string>>>(buffer);
+        assert(read.get_size() == 3 && read[0] == words && read[1].is_empty() && read[2][0] == "one");
+
+        //   
+        std::string bytes = buffer.str().substr(0, binary_size(words) - 1);
+        std::stringstream truncated(bytes);
+        try
+        {
+            read_binary<SimpleVector<string>>(truncated);
+            assert(false);
+        }
+        catch (const runtime_error&)
+        {
+        }
+
+        std::stringstream wrong_type(buffer.str());
+        try
+        {
+            read_binary<SimpleVector<int>>(wrong_type);
+            assert(false);
+        }
+        catch (const runtime_error&)
+        {
+        }
+    }
+
+#if !defined(_WIN32)
+    {
+        //     :     
+        const std::string path = (std::filesystem::temp_directory_path() / "simple_vector_binary_test.bin").string();
+
+        SimpleVector<double> numbers(100000, 0.5);
+        SimpleVector<string> words(5000, "word");
+
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        assert(fd >= 0);
+        write_binary(fd, numbers);
+        write_binary(fd, words);
+        write_binary(fd, numbers);
+
+        ::lseek(fd, 0, SEEK_SET);
+        assert(read_binary<SimpleVector<double>>(fd) == numbers);
+        assert(read_binary<SimpleVector<string>>(fd) == words);
+        assert(read_binary<SimpleVector<double>>(fd) == numbers);
+        ::close(fd);
+
+        std::filesystem::remove(path);
+    }
+#endif
+}
+
+// :   , ,  simd  parallel  
+inline void Test24()
+{
+    static_assert(std::ranges::contiguous_range<SimpleVectorView<int>>);
+    static_assert(std::ranges::borrowed_range<SimpleVectorView<const int>>);
+    static_assert(std::is_trivially_copyable_v<SimpleVectorView<int>>);
+
+    //    const,          
+    struct Base { int a; };
+    struct Derived : Base { int b; };
+    static_assert(std::is_constructible_v<SimpleVectorView<const Base>, SimpleVector<Base>&>);
+    static_assert(!std::is_constructible_v<SimpleVectorView<Base>, SimpleVector<Derived>&>);
+    static_assert(!std::is_constructible_v<SimpleVectorView<const Base>, SimpleVectorView<Derived>>);
+    static_assert(!std::is_constructible_v<SimpleVectorView<Base>, Derived*, size_t>);
+    static_assert(!std::is_constructible_v<SimpleVectorView<int>, const SimpleVector<int>&>);
+
+    SimpleVector<int> v(100);
+    std::iota(v.begin(), v.end(), 0);
+
+    //    , SimpleVector    
+    auto sum = [](SimpleVectorView<const int> view) { return std::accumulate(view.begin(), view.end(), 0); };
+    assert(sum(v) == 4950);
+
+    SimpleVectorView view(v);
+    static_assert(std::is_same_v<decltype(view), SimpleVectorView<int>>);
+    assert(view.get_size() == 100 && view.data() == v.data());
+
+    SimpleVectorView<int> middle = view.subview(10, 20);
+    assert(middle.get_size() == 20 && middle.front() == 10 && middle.back() == 29);
+    assert(sum(middle) == 390);
+    assert(middle.subview(5).get_size() == 15 && middle.subview(5)[0] == 15);
+    assert(view.subview(100).is_empty() && view.subview(90, 1000).get_size() == 10);
+    assert(view.first(3) == SimpleVectorView<const int>(v.data(), 3));
+    assert(view.last(1).front() == 99);
+
+    try
+    {
+        view.subview(101);
+        assert(false);
+    }
+    catch (const out_of_range&)
+    {
+    }
+    try
+    {
+        middle.at(20);
+        assert(false);
+    }
+    catch (const out_of_range&)
+    {
+    }
+
+    SimpleVectorView<const int> tail = view;
+    tail.remove_prefix(95);
+    tail.remove_suffix(1);
+    assert(tail.get_size() == 4 && tail[0] == 95 && tail[3] == 98);
+
+    //    SimpleVector
+    SimpleVector<int> other{ 10, 11, 12 };
+    assert(middle.first(3) == SimpleVectorView(other));
+    assert(middle.first(3) != SimpleVectorView(other).first(2));
+    assert(SimpleVectorView(other).first(2) < middle.first(3));
+    assert(view.first(3) < middle.first(3) && middle >= middle && !(middle > middle));
+
+    //     std::ranges   ,    
+    assert(simd_count(middle, 15) == 1 && *simd_max_element(middle) == 29);
+    assert(parallel_reduce(view.subview(50), 0L, std::plus<>()) == 3725);
+    parallel_fill(middle, 7);
+    assert(v[9] == 9 && v[10] == 7 && v[29] == 7 && v[30] == 30);
+    std::ranges::sort(view.first(10), std::greater<>());
+    assert(v[0] == 9 && v[9] == 0);
+    auto found = std::ranges::find(view.subview(30), 42);
+    assert(found == v.begin() + 42);
+
+    //  :  ArrayPtr, SmallSimpleVector,  view_binary
+    ArrayPtr<int> array(4);
+    array[0] = 1;
+    array[1] = 2;
+    SimpleVectorView<int> prefix(array, 2);
+    assert(prefix.get_size() == 2 && prefix[0] == 1 && prefix[1] == 2 && prefix.data() == array.get());
+
+    SmallSimpleVector<int, 4> small{ 10, 11, 12 };
+    assert(SimpleVectorView(small) == SimpleVectorView(other));
+
+    std::stringstream buffer;
+    write_binary(buffer, other);
+    SimpleVector<uint64_t> storage(8);
+    std::string bytes = buffer.str();
+    std::memcpy(storage.data(), bytes.data(), bytes.size());
+    SimpleVectorView<const int> received = view_binary<int>(storage.data(), bytes.size());
+    assert(received == SimpleVectorView(other));
+}
+
+//   : O(1) ,    ,    
+inline void Test25()
+{
+    {
+        CowSimpleVector<Counted> table;
+        for (int i = 0; i < 10; ++i)
+        {
+            table.push_back(Counted(i));
+        }
+        assert(Counted::alive == 10 && table.use_count() == 1);
+
+        //       
+        CowSimpleVector<Counted> snapshot = table;
+        const CowSimpleVector<Counted>& reader = snapshot;
+        assert(Counted::alive == 10 && table.use_count() == 2 && table.is_shared());
+        assert(reader.data() == std::as_const(table).data());
+        assert(reader[3].get_value() == 3 && reader.at(9).get_value() == 9 && reader.view().get_size() == 10);
+
+        //      ,    
+        table.push_back(Counted(10));
+        assert(Counted::alive == 21 && !table.is_shared() && !snapshot.is_shared());
+        assert(table.get_size() == 11 && snapshot.get_size() == 10);
+        table.push_back(Counted(11));
+        assert(Counted::alive == 22);
+
+        //        
+        CowSimpleVector<Counted> erased = snapshot;
+        auto it = erased.erase(erased.cbegin() + 2, erased.cbegin() + 5);
+        assert(it->get_value() == 5 && erased.get_size() == 7 && Counted::alive == 29);
+        assert(snapshot.get_size() == 10 && std::as_const(snapshot)[2].get_value() == 2);
+
+        CowSimpleVector<Counted> popped = snapshot;
+        popped.pop_back();
+        assert(popped.get_size() == 9 && popped.get_capacity() == 9 && Counted::alive == 38);
+        popped.pop_back();
+        assert(Counted::alive == 37);
+
+        CowSimpleVector<Counted> cleared = snapshot;
+        cleared.clear();
+        assert(cleared.is_empty() && snapshot.use_count() == 1 && Counted::alive == 37);
+
+        //  ,    
+        CowSimpleVector<Counted> inserted = snapshot;
+        inserted.insert(inserted.cbegin(), snapshot[9]);
+        inserted.emplace(inserted.cbegin() + 1, snapshot[8]);
+        inserted.insert(inserted.cbegin(), 2, snapshot[7]);
+        assert(inserted.get_size() == 14 && inserted[0].get_value() == 7 && inserted[2].get_value() == 9 && inserted[3].get_value() == 8);
+    }
+    assert(Counted::alive == 0);
+
+    {
+        CowSimpleVector<int> v{ 1, 2, 3 };
+        CowSimpleVector<int> copy = v;
+        assert(copy == v && !(copy < v));
+
+        //    
+        copy[0] = 10;
+        assert(std::as_const(v)[0] == 1 && copy[0] == 10 && copy != v && v < copy);
+
+        *copy.begin() = 20;
+        assert(copy.front() == 20 && v.use_count() == 1);
+
+        CowSimpleVector<int> adopted(SimpleVector<int>{ 4, 5 });
+        assert(adopted.get_size() == 2 && adopted.back() == 5);
+
+        CowSimpleVector<int> shrunk = v;
+        shrunk.resize(2);
+        assert(shrunk.get_size() == 2 && shrunk.get_capacity() == 2 && v.get_size() == 3);
+        shrunk.resize(4);
+        assert(shrunk[3] == 0);
+
+        CowSimpleVector<int> empty;
+        assert(empty.begin() == nullptr && empty.use_count() == 0);
+        empty.reserve(10);
+        assert(empty.get_capacity() == 10 && empty.is_empty());
+    }
+
+    {
+        //        
+        CowSimpleVector<int> a{ 1, 2, 3 };
+        int& ref = a[0];
+        auto snap = a;
+        ref = 42;
+        assert(std::as_const(snap)[0] == 1 && std::as_const(a)[0] == 42 && !a.is_shared() && !snap.is_shared());
+
+        int* it = a.begin();
+        CowSimpleVector<int> assigned;
+        assigned = a;
+        it[1] = 99;
+        assert(std::as_const(assigned)[1] == 2 && std::as_const(a)[1] == 99);
+
+        //     ,      
+        a.clear();
+        a.push_back(5);
+        auto shared_copy = a;
+        assert(a.use_count() == 2 && std::as_const(shared_copy).data() == std::as_const(a).data());
+
+        //        
+        CowSimpleVector<string> words{ "alpha", "beta", "gamma" };
+        words.erase(words.cbegin() + 1, words.cbegin() + 1);
+        assert(words.get_size() == 3 && words.back() == "gamma" && std::as_const(words)[1] == "beta");
+    }
+
+    {
+        //  pmr  :     ,   
+        char first_buffer[4096];
+        char second_buffer[4096];
+        std::pmr::monotonic_buffer_resource first(first_buffer, sizeof(first_buffer), std::pmr::null_memory_resource());
+        std::pmr::monotonic_buffer_resource second(second_buffer, sizeof(second_buffer), std::pmr::null_memory_resource());
+        auto in_first = [&](const int* item) { return reinterpret_cast<const char*>(item) >= first_buffer && reinterpret_cast<const char*>(item) < first_buffer + sizeof(first_buffer); };
+
+        using PmrCow = CowSimpleVector<int, std::pmr::polymorphic_allocator<int>>;
+        static_assert(!std::is_nothrow_move_assignable_v<PmrCow> && std::is_nothrow_move_assignable_v<CowSimpleVector<int>>);
+
+        PmrCow source({ 1, 2, 3 }, &second);
+        PmrCow target(&first);
+        target = source;
+        assert(target.use_count() == 1 && source.use_count() == 1 && target == source && in_first(target.cbegin()));
+
+        PmrCow same(&first);
+        same = target;
+        assert(same.use_count() == 2 && same.get_allocator().resource() == &first);
+
+        PmrCow moved(&first);
+        moved = std::move(source);
+        assert(moved.get_size() == 3 && std::as_const(moved)[2] == 3 && source.is_empty() && in_first(moved.cbegin()));
+
+        PmrCow shared_source = moved;
+        PmrCow from_shared(&second);
+        from_shared = std::move(shared_source);
+        assert(from_shared == moved && moved.use_count() == 1 && from_shared.get_allocator().resource() == &second);
+
+        same.swap(moved);
+        assert(same.get_size() == 3 && moved.use_count() == 2);
+    }
+
+    {
+        //        
+        CowSimpleVector<int> routes(1000, 7);
+        const int* original = std::as_const(routes).data();
+
+        SimpleVector<std::thread> threads;
+        for (int t = 0; t < 8; ++t)
+        {
+            threads.emplace_back([routes, t]() mutable
+            {
+                routes[0] = t;
+                for (int i = 1; i < 100; ++i)
+                {
+                    CowSimpleVector<int> snapshot = routes;
+                    snapshot[i] = t;
+                    assert(std::as_const(snapshot)[0] == t && std::as_const(routes)[i] == 7);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        assert(std::as_const(routes).data() == original && routes.use_count() == 1);
+        assert(std::all_of(routes.cbegin(), routes.cend(), [](int value) { return value == 7; }));
+    }
+}
+
+//  :   push_back, set, slice  concat,    
+inline void Test26()
+{
+    static_assert(std::random_access_iterator<PersistentSimpleVector<int>::ConstIterator>);
+
+    {
+        //     
+        PersistentSimpleVector<int> v;
+        SimpleVector<PersistentSimpleVector<int>> versions;
+        for (int i = 0; i < 5000; ++i)
+        {
+            if (i % 1000 == 0)
+            {
+                versions.push_back(v);
+            }
+            v = v.push_back(i);
+        }
+        assert(v.get_size() == 5000 && v.front() == 0 && v.back() == 4999 && v.get_depth() == 2);
+        for (size_t k = 0; k < versions.get_size(); ++k)
+        {
+            assert(versions[k].get_size() == k * 1000);
+            for (size_t i = 0; i < versions[k].get_size(); ++i)
+            {
+                assert(versions[k][i] == static_cast<int>(i));
+            }
+        }
+        assert(std::accumulate(v.begin(), v.end(), 0LL) == 4999LL * 5000 / 2);
+
+        PersistentSimpleVector<int> changed = v.set(1234, -1).set(4990, -2);
+        assert(changed[1234] == -1 && changed[4990] == -2 && v[1234] == 1234 && v[4990] == 4990);
+        assert(changed != v && changed.set(1234, 1234).set(4990, 4990) == v);
+
+        try
+        {
+            [[maybe_unused]] auto wrong = v.set(5000, 0);
+            assert(false);
+        }
+        catch (const std::out_of_range&)
+        {
+        }
+
+        //    ,     
+        const size_t bounds[][2] = { { 0, 5000 }, { 0, 0 }, { 31, 33 }, { 100, 4000 }, { 4990, 5000 }, { 1, 4999 }, { 1024, 2048 }, { 5000, 5000 } };
+        for (const auto& bound : bounds)
+        {
+            PersistentSimpleVector<int> slice = v.slice(bound[0], bound[1]);
+            assert(slice.get_size() == bound[1] - bound[0]);
+            for (size_t i = 0; i < slice.get_size(); ++i)
+            {
+                assert(slice[i] == static_cast<int>(bound[0] + i));
+            }
+            slice = slice.push_back(-1);
+            assert(slice.back() == -1 && v.get_size() == 5000);
+        }
+        assert(v.slice(2000, 2010).get_depth() <= 1);
+    }
+
+    {
+        //          
+        SimpleVector<int> source(20000);
+        std::iota(source.begin(), source.end(), 0);
+        PersistentSimpleVector<int> all(source);
+
+        SimpleVector<int> expected;
+        PersistentSimpleVector<int> joined;
+        uint32_t seed = 12345;
+        auto next = [&seed](uint32_t bound)
+        {
+            seed = seed * 1664525 + 1013904223;
+            return (seed >> 8) % bound;
+        };
+        for (int round = 0; round < 300; ++round)
+        {
+            size_t first = next(20000);
+            size_t last = std::min<size_t>(source.get_size(), first + next(round % 3 == 0 ? 40 : 2000));
+            PersistentSimpleVector<int> piece = all.slice(first, last);
+            joined = round % 2 ? joined.concat(piece) : piece.concat(joined);
+            if (round % 2)
+            {
+                expected.append_range(source.begin() + first, source.begin() + last);
+            }
+            else
+            {
+                expected.insert(expected.begin(), source.begin() + first, source.begin() + last);
+            }
+            joined = joined.push_back(round);
+            expected.push_back(round);
+        }
+        assert(joined.get_size() == expected.get_size() && joined.get_depth() <= 4);
+        assert(std::equal(joined.begin(), joined.end(), expected.begin(), expected.end()));
+        for (size_t i = 0; i < expected.get_size(); i += 7)
+        {
+            assert(joined[i] == expected[i]);
+        }
+        assert(joined.to_simple_vector() == expected);
+
+        PersistentSimpleVector<int> middle = joined.slice(1000, joined.get_size() - 1000);
+        assert(std::equal(middle.begin(), middle.end(), expected.begin() + 1000, expected.end() - 1000));
+        assert(middle.concat(PersistentSimpleVector<int>{ 1, 2 }).back() == 2);
+        assert(PersistentSimpleVector<int>().concat(middle) == middle && middle.concat({}) == middle);
+    }
+
+    {
+        //    ,  persistent()  
+        TransientSimpleVector<Counted> builder;
+        for (int i = 0; i < 3000; ++i)
+        {
+            builder.push_back(Counted(i));
+        }
+        assert(Counted::alive == 3000);
+
+        PersistentSimpleVector<Counted> snapshot = builder.persistent();
+        assert(Counted::alive == 3000);
+
+        builder.set(10, Counted(-10));
+        builder.push_back(Counted(3000));
+        assert(builder[10].get_value() == -10 && builder.get_size() == 3001);
+        assert(snapshot[10].get_value() == 10 && snapshot.get_size() == 3000);
+
+        //          
+        int alive = Counted::alive;
+        builder.set(11, Counted(-11));
+        assert(Counted::alive == alive);
+
+        SimpleVector<Counted> flat = builder.to_simple_vector();
+        assert(flat.get_size() == 3001 && flat.get_capacity() == 3001 && flat[11].get_value() == -11 && flat[3000].get_value() == 3000);
+
+        TransientSimpleVector<Counted> resumed = snapshot.transient();
+        resumed.append(snapshot.slice(0, 5));
+        assert(resumed.get_size() == 3005 && resumed[3004].get_value() == 4 && snapshot.get_size() == 3000);
+    }
+    assert(Counted::alive == 0);
+
+    {
+        //        
+        PersistentSimpleVector<ThrowingCopy> v;
+        for (int i = 0; i < 100; ++i)
+        {
+            v = v.push_back(ThrowingCopy(i));
+        }
+        ThrowingCopy::copy_budget = 3;
+        try
+        {
+            [[maybe_unused]] auto failed = v.set(5, ThrowingCopy(-1));
+            assert(false);
+        }
+        catch (const runtime_error&)
+        {
+        }
+        ThrowingCopy::copy_budget = -1;
+        assert(v.get_size() == 100 && v[5].get_value() == 5 && v[99].get_value() == 99);
+    }
+    assert(ThrowingCopy::alive == 0);
+
+    {
+        //       
+        PersistentSimpleVector<int> base;
+        for (int i = 0; i < 2000; ++i)
+        {
+            base = base.push_back(i);
+        }
+
+        SimpleVector<std::thread> threads;
+        for (int t = 0; t < 8; ++t)
+        {
+            threads.emplace_back([&base, t]
+            {
+                PersistentSimpleVector<int> local = base;
+                for (int i = 0; i < 200; ++i)
+                {
+                    local = local.set(i, t).push_back(t);
+                }
+                assert(local.get_size() == 2200 && local[0] == t && local[1999] == 1999 && local.back() == t);
+                assert(base[0] == 0 && base.get_size() == 2000);
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
+
+//   :    ,  ,   
+inline void Test27()
+{
+    using Small = ChunkedSimpleVector<int, std::allocator<int>, 64 * sizeof(int)>;
+    static_assert(Small::kChunkSize == 64);
+    static_assert(std::random_access_iterator<Small::Iterator> && std::random_access_iterator<Small::ConstIterator>);
+    static_assert(ChunkedSimpleVector<char[3]>::kChunkSize == 16384);
+
+    {
+        //    ,     
+        Small v;
+        v.push_back(0);
+        int* first = &v[0];
+        SimpleVector<int*> addresses;
+        for (int i = 1; i < 10000; ++i)
+        {
+            v.push_back(i);
+            if (i % 1000 == 0)
+            {
+                addresses.push_back(&v[i]);
+            }
+            assert(v.get_capacity() - v.get_size() < Small::kChunkSize);
+        }
+        assert(&v[0] == first && *first == 0);
+        for (size_t k = 0; k < addresses.get_size(); ++k)
+        {
+            assert(addresses[k] == &v[(k + 1) * 1000] && *addresses[k] == static_cast<int>((k + 1) * 1000));
+        }
+        assert(v.get_chunk_count() == 157 && v.chunk(156).get_size() == 10000 - 156 * 64 && v.chunk(3)[0] == 192);
+        assert(std::accumulate(v.cbegin(), v.cend(), 0LL) == 9999LL * 10000 / 2);
+
+        //    
+        std::reverse(v.begin(), v.end());
+        assert(v.front() == 9999 && v.back() == 0);
+        std::sort(v.begin(), v.end());
+        assert(std::is_sorted(v.begin(), v.end()) && v[5000] == 5000 && &v[0] == first);
+
+        v.resize(100);
+        assert(v.get_size() == 100 && v.get_capacity() == 10048);
+        v.shrink_to_fit();
+        assert(v.get_capacity() == 128 && v.get_chunk_count() == 2 && &v[0] == first);
+        v.resize(130);
+        assert(v[129] == 0 && v[99] == 99 && v.get_capacity() == 192);
+        v.clear();
+        assert(v.is_empty() && v.get_capacity() == 192);
+    }
+
+    {
+        //      SimpleVector
+        Small v;
+        SimpleVector<int> expected;
+        for (int i = 0; i < 300; ++i)
+        {
+            v.push_back(i);
+            expected.push_back(i);
+        }
+
+        v.insert(v.cbegin() + 70, -1);
+        expected.insert(expected.cbegin() + 70, -1);
+        v.emplace(v.cbegin(), -2);
+        expected.emplace(expected.cbegin(), -2);
+        v.insert(v.cbegin() + 200, 100, 7);
+        expected.insert(expected.cbegin() + 200, 100, 7);
+        v.insert(v.cend(), { 1, 2, 3 });
+        expected.insert(expected.cend(), { 1, 2, 3 });
+        auto it = v.insert(v.cbegin() + 5, v[0]);
+        expected.insert(expected.cbegin() + 5, expected[0]);
+        assert(*it == -2);
+
+        it = v.erase(v.cbegin() + 10, v.cbegin() + 150);
+        expected.erase(expected.cbegin() + 10, expected.cbegin() + 150);
+        assert(*it == expected[10]);
+        v.erase(v.cbegin() + 3);
+        expected.erase(expected.cbegin() + 3);
+        v.unordered_erase(v.cbegin() + 1);
+        expected.unordered_erase(expected.cbegin() + 1);
+        assert(v.erase_if([](int value) { return value % 3 == 0; }) == expected.erase_if([](int value) { return value % 3 == 0; }));
+
+        assert(v.get_size() == expected.get_size() && std::equal(v.begin(), v.end(), expected.begin(), expected.end()));
+
+        Small copy = v;
+        assert(copy == v && !(copy < v) && copy.get_capacity() < copy.get_size() + Small::kChunkSize);
+        copy.back() = 1000;
+        assert(copy != v && v < copy);
+
+        Small moved = std::move(copy);
+        assert(copy.is_empty() && moved.back() == 1000);
+
+        Small filled(100, 5);
+        Small sized(100);
+        assert(filled.get_size() == 100 && filled[99] == 5 && sized[99] == 0 && Small(reserve(70)).get_capacity() == 128);
+    }
+
+    {
+        //       
+        ChunkedSimpleVector<ThrowingCopy, std::allocator<ThrowingCopy>, 16 * sizeof(ThrowingCopy)> v;
+        for (int i = 0; i < 50; ++i)
+        {
+            v.emplace_back(i);
+        }
+        ThrowingCopy::copy_budget = 20;
+        try
+        {
+            auto copy = v;
+            assert(false);
+        }
+        catch (const runtime_error&)
+        {
+        }
+        ThrowingCopy::copy_budget = 5;
+        try
+        {
+            v.insert(v.cbegin() + 10, 30, v[0]);
+            assert(false);
+        }
+        catch (const runtime_error&)
+        {
+        }
+        ThrowingCopy::copy_budget = -1;
+        assert(ThrowingCopy::alive == 50 && v.get_size() == 50 && v[10].get_value() == 10);
+    }
+    assert(ThrowingCopy::alive == 0);
+
+    {
+        ChunkedSimpleVector<Counted> v;
+        for (int i = 0; i < 5000; ++i)
+        {
+            v.emplace_back(i);
+        }
+        v.erase(v.cbegin(), v.cbegin() + 100);
+        assert(Counted::alive == 4900 && v.front().get_value() == 100);
+    }
+    assert(Counted::alive == 0);
+
+    {
+        //  pmr  :          
+        std::pmr::synchronized_pool_resource first;
+        std::pmr::synchronized_pool_resource second;
+
+        using PmrChunked = ChunkedSimpleVector<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>, 4 * sizeof(std::pmr::string)>;
+        static_assert(!std::is_nothrow_move_assignable_v<PmrChunked>);
+
+        PmrChunked source(&second);
+        for (int i = 0; i < 10; ++i)
+        {
+            source.push_back(std::pmr::string(40, char('a' + i)));
+        }
+
+        PmrChunked target(&first);
+        target.push_back("old");
+        target = source;
+        assert(target == source && target.get_allocator().resource() == &first && target[9].get_allocator().resource() == &first);
+
+        PmrChunked moved(&first);
+        moved = std::move(source);
+        assert(moved == target && moved.get_allocator().resource() == &first && moved[5].get_allocator().resource() == &first);
+
+        //  :      
+        const std::pmr::string* kept = &moved[7];
+        PmrChunked same(&first);
+        same = std::move(moved);
+        assert(&same[7] == kept && moved.is_empty());
+
+        same.swap(target);
+        assert(&target[7] == kept && same.get_size() == 10);
+    }
+
+    {
+        //        
+        ChunkedSimpleVector<string, std::allocator<string>, 4 * sizeof(string)> v{ "alpha", "beta", "gamma", "delta", "epsilon" };
+        auto it = v.erase(v.cbegin() + 1, v.cbegin() + 1);
+        assert(it == v.begin() + 1 && v.get_size() == 5);
+        assert(v[1] == "beta" && v[2] == "gamma" && v[4] == "epsilon");
+    }
+}
+
 void TestRun()
 {
     Test1();
     Test2();
     Test3();
+    Test4();
+    Test5();
+    Test6();
+    Test7();
+    Test8();
+    Test9();
+    Test10();
+    Test11();
+    Test12();
+    Test13();
+    Test14();
+    Test15();
+    Test16();
+    Test17();
+    Test18();
+    Test19();
+    Test20();
+    Test21();
+    Test22();
+    Test23();
+    Test24();
+    Test25();
+    Test26();
+    Test27();
 
     std::cout << "All tests have been passed"s << endl << endl;
 }
\ No newline at end of file
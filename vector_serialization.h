@@ -0,0 +1,525 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+//   SimpleVector:  BinaryVectorHeader     .  
+//      ,     -  uint64  .
+//      ,       
+
+//    .   32,      
+struct BinaryVectorHeader
+{
+    static constexpr uint64_t kMagic = 0x5952414E49425653ull; // "SVBINARY"
+    static constexpr uint64_t kSwappedMagic = 0x5356424942414E59ull;
+    static constexpr uint16_t kVersion = 1;
+
+    static constexpr uint16_t kRawEncoding = 1;      //   
+    static constexpr uint16_t kEncodedEncoding = 2;  //   BinaryCodec
+
+    uint64_t magic;
+    uint16_t version;
+    uint16_t encoding;
+    uint32_t element_size;
+    uint64_t size;
+    uint64_t payload_bytes;
+};
+
+static_assert(sizeof(BinaryVectorHeader) == 32, "BinaryVectorHeader layout is part of the format");
+
+//=====================================================================     ================================================================
+
+//  :  std::ostream   .    ,
+//          
+class BinaryOutput
+{
+public:
+
+    explicit BinaryOutput(std::ostream& out) noexcept : stream(&out){}
+
+    explicit BinaryOutput(int fd) : fd(fd), buffer(kBufferSize){}
+
+    //  bytes   source O(N)
+    void write(const void* source, size_t bytes)
+    {
+        const char* data = static_cast<const char*>(source);
+
+        if (stream)
+        {
+            stream->write(data, static_cast<std::streamsize>(bytes));
+            if (!*stream)
+            {
+                throw std::runtime_error("Failed to write binary vector data");
+            }
+            return;
+        }
+
+        if (used + bytes > buffer.get_size())
+        {
+            flush();
+        }
+        if (bytes >= buffer.get_size())
+        {
+            write_fd(data, bytes);
+            return;
+        }
+        std::memcpy(buffer.data() + used, data, bytes);
+        used += bytes;
+    }
+
+    //     O(N)
+    void flush()
+    {
+        if (used > 0)
+        {
+            write_fd(buffer.data(), used);
+            used = 0;
+        }
+    }
+
+private:
+
+    static constexpr size_t kBufferSize = 64 * 1024;
+
+    std::ostream* stream = nullptr;
+    int fd = -1;
+    SimpleVector<char> buffer;
+    size_t used = 0;
+
+    //     bytes ,      O(N)
+    void write_fd(const char* data, size_t bytes)
+    {
+        while (bytes > 0)
+        {
+#if defined(_WIN32)
+            int written = _write(fd, data, static_cast<unsigned>(std::min<size_t>(bytes, std::numeric_limits<int>::max())));
+#else
+            ssize_t written = ::write(fd, data, bytes);
+            if (written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+#endif
+            if (written < 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "write");
+            }
+            data += written;
+            bytes -= static_cast<size_t>(written);
+        }
+    }
+};
+
+//  :  std::istream   .       
+//  ,        
+class BinaryInput
+{
+public:
+
+    explicit BinaryInput(std::istream& in) noexcept : stream(&in){}
+
+    explicit BinaryInput(int fd) : fd(fd), buffer(kBufferSize){}
+
+    //   bytes   dest,     O(N)
+    void read(void* dest, size_t bytes)
+    {
+        if (bytes > remaining)
+        {
+            throw std::runtime_error("Binary vector data is corrupted");
+        }
+        remaining -= bytes;
+
+        char* data = static_cast<char*>(dest);
+
+        if (stream)
+        {
+            stream->read(data, static_cast<std::streamsize>(bytes));
+            if (stream->gcount() != static_cast<std::streamsize>(bytes))
+            {
+                throw std::runtime_error("Unexpected end of binary vector data");
+            }
+            return;
+        }
+
+        size_t buffered = std::min(bytes, end - position);
+        std::memcpy(data, buffer.data() + position, buffered);
+        position += buffered;
+        data += buffered;
+        bytes -= buffered;
+
+        if (bytes >= buffer.get_size())
+        {
+            read_fd(data, bytes);
+        }
+        else if (bytes > 0)
+        {
+            //       
+            end = std::min(buffer.get_size(), bytes + remaining);
+            read_fd(buffer.data(), end);
+            std::memcpy(data, buffer.data(), bytes);
+            position = bytes;
+        }
+    }
+
+    //      O(1)
+    uint64_t get_remaining() const noexcept
+    {
+        return remaining;
+    }
+
+    //   limit  O(1)
+    void set_remaining(uint64_t limit) noexcept
+    {
+        remaining = limit;
+    }
+
+private:
+
+    static constexpr size_t kBufferSize = 64 * 1024;
+
+    std::istream* stream = nullptr;
+    int fd = -1;
+    SimpleVector<char> buffer;
+    size_t position = 0;
+    size_t end = 0;
+    uint64_t remaining = sizeof(BinaryVectorHeader);
+
+    //     bytes ,      O(N)
+    void read_fd(char* data, size_t bytes)
+    {
+        while (bytes > 0)
+        {
+#if defined(_WIN32)
+            int received = _read(fd, data, static_cast<unsigned>(std::min<size_t>(bytes, std::numeric_limits<int>::max())));
+#else
+            ssize_t received = ::read(fd, data, bytes);
+            if (received < 0 && errno == EINTR)
+            {
+                continue;
+            }
+#endif
+            if (received < 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "read");
+            }
+            if (received == 0)
+            {
+                throw std::runtime_error("Unexpected end of binary vector data");
+            }
+            data += received;
+            bytes -= static_cast<size_t>(received);
+        }
+    }
+};
+
+//=======================================================================  ======================================================================
+
+//  .        (kRaw),  
+//    encoded_size(value), write(out, value)  read(in)
+template <typename Type>
+struct BinaryCodec
+{
+    static_assert(std::is_trivially_copyable_v<Type>, "Specialize BinaryCodec to serialize this element type");
+
+    static constexpr bool kRaw = true;
+};
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void write_elements(BinaryOutput& out, const SimpleVector<Type, Allocator, GrowthPolicy>& vector);
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void read_elements(BinaryInput& in, SimpleVector<Type, Allocator, GrowthPolicy>& vector, uint64_t count);
+
+//  ,     O(N)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+uint64_t encoded_elements_size(const SimpleVector<Type, Allocator, GrowthPolicy>& vector)
+{
+    if constexpr (BinaryCodec<Type>::kRaw)
+    {
+        return static_cast<uint64_t>(vector.get_size()) * sizeof(Type);
+    }
+    else
+    {
+        uint64_t bytes = 0;
+        for (const Type& item : vector)
+        {
+            bytes += BinaryCodec<Type>::encoded_size(item);
+        }
+        return bytes;
+    }
+}
+
+// :     
+template <typename Char, typename Traits, typename Allocator>
+struct BinaryCodec<std::basic_string<Char, Traits, Allocator>>
+{
+    using String = std::basic_string<Char, Traits, Allocator>;
+
+    static constexpr bool kRaw = false;
+
+    static uint64_t encoded_size(const String& value) noexcept
+    {
+        return sizeof(uint64_t) + value.size() * sizeof(Char);
+    }
+
+    static void write(BinaryOutput& out, const String& value)
+    {
+        uint64_t length = value.size();
+        out.write(&length, sizeof(length));
+        out.write(value.data(), value.size() * sizeof(Char));
+    }
+
+    static String read(BinaryInput& in)
+    {
+        uint64_t length = 0;
+        in.read(&length, sizeof(length));
+        if (length > in.get_remaining() / sizeof(Char))
+        {
+            throw std::runtime_error("Binary vector data is corrupted");
+        }
+
+        String value(static_cast<size_t>(length), Char());
+        in.read(value.data(), value.size() * sizeof(Char));
+        return value;
+    }
+};
+
+//  :    
+template <typename Type, typename Allocator, typename GrowthPolicy>
+struct BinaryCodec<SimpleVector<Type, Allocator, GrowthPolicy>>
+{
+    using Vector = SimpleVector<Type, Allocator, GrowthPolicy>;
+
+    static constexpr bool kRaw = false;
+
+    static uint64_t encoded_size(const Vector& value)
+    {
+        return sizeof(uint64_t) + encoded_elements_size(value);
+    }
+
+    static void write(BinaryOutput& out, const Vector& value)
+    {
+        uint64_t count = value.get_size();
+        out.write(&count, sizeof(count));
+        write_elements(out, value);
+    }
+
+    static Vector read(BinaryInput& in)
+    {
+        uint64_t count = 0;
+        in.read(&count, sizeof(count));
+
+        Vector value;
+        read_elements(in, value, count);
+        return value;
+    }
+};
+
+//   :    ,    O(N)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void write_elements(BinaryOutput& out, const SimpleVector<Type, Allocator, GrowthPolicy>& vector)
+{
+    if constexpr (BinaryCodec<Type>::kRaw)
+    {
+        out.write(vector.data(), vector.get_size() * sizeof(Type));
+    }
+    else
+    {
+        for (const Type& item : vector)
+        {
+            BinaryCodec<Type>::write(out, item);
+        }
+    }
+}
+
+//    count  .    ,  
+//        O(N)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void read_elements(BinaryInput& in, SimpleVector<Type, Allocator, GrowthPolicy>& vector, uint64_t count)
+{
+    if constexpr (BinaryCodec<Type>::kRaw)
+    {
+        if (count > in.get_remaining() / sizeof(Type))
+        {
+            throw std::runtime_error("Binary vector data is corrupted");
+        }
+        vector.append_constructed(static_cast<size_t>(count), [&](Type* first, Type* last)
+        {
+            in.read(first, (last - first) * sizeof(Type));
+        });
+    }
+    else
+    {
+        //        ,      
+        vector.reserve(vector.get_size() + static_cast<size_t>(std::min(count, in.get_remaining())));
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            vector.push_back(BinaryCodec<Type>::read(in));
+        }
+    }
+}
+
+//==================================================================     ===============================================================
+
+//        O(1)   ,  O(N)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+uint64_t binary_size(const SimpleVector<Type, Allocator, GrowthPolicy>& vector)
+{
+    return sizeof(BinaryVectorHeader) + encoded_elements_size(vector);
+}
+
+//    out O(N)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void write_binary(BinaryOutput& out, const SimpleVector<Type, Allocator, GrowthPolicy>& vector)
+{
+    BinaryVectorHeader header{};
+    header.magic = BinaryVectorHeader::kMagic;
+    header.version = BinaryVectorHeader::kVersion;
+    header.encoding = BinaryCodec<Type>::kRaw ? BinaryVectorHeader::kRawEncoding : BinaryVectorHeader::kEncodedEncoding;
+    header.element_size = BinaryCodec<Type>::kRaw ? static_cast<uint32_t>(sizeof(Type)) : 0;
+    header.size = vector.get_size();
+    header.payload_bytes = encoded_elements_size(vector);
+
+    out.write(&header, sizeof(header));
+    write_elements(out, vector);
+}
+
+//     O(N)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void write_binary(std::ostream& out, const SimpleVector<Type, Allocator, GrowthPolicy>& vector)
+{
+    BinaryOutput output(out);
+    write_binary(output, vector);
+}
+
+//     ,  std::system_error    O(N)
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void write_binary(int fd, const SimpleVector<Type, Allocator, GrowthPolicy>& vector)
+{
+    BinaryOutput output(fd);
+    write_binary(output, vector);
+    output.flush();
+}
+
+// ,      Type    
+template <typename Type>
+void check_binary_header(const BinaryVectorHeader& header)
+{
+    if (header.magic == BinaryVectorHeader::kSwappedMagic)
+    {
+        throw std::runtime_error("Binary vector was written with a different byte order");
+    }
+    if (header.magic != BinaryVectorHeader::kMagic || header.version != BinaryVectorHeader::kVersion)
+    {
+        throw std::runtime_error("Data is not a binary vector of a supported version");
+    }
+
+    if constexpr (BinaryCodec<Type>::kRaw)
+    {
+        if (header.encoding != BinaryVectorHeader::kRawEncoding || header.element_size != sizeof(Type))
+        {
+            throw std::runtime_error("Binary vector element type mismatch");
+        }
+        if (header.size > header.payload_bytes / sizeof(Type) || header.size * sizeof(Type) != header.payload_bytes)
+        {
+            throw std::runtime_error("Binary vector header is corrupted");
+        }
+    }
+    else if (header.encoding != BinaryVectorHeader::kEncodedEncoding)
+    {
+        throw std::runtime_error("Binary vector element type mismatch");
+    }
+}
+
+//    ,       O(1)
+template <typename Type>
+BinaryVectorHeader read_binary_header(BinaryInput& in)
+{
+    BinaryVectorHeader header;
+    in.set_remaining(sizeof(header));
+    in.read(&header, sizeof(header));
+    check_binary_header<Type>(header);
+
+    in.set_remaining(header.payload_bytes);
+    return header;
+}
+
+//  ,  write_binary.       O(N)
+template <typename Vector>
+Vector read_binary(BinaryInput& in, const typename Vector::allocator_type& alloc = typename Vector::allocator_type())
+{
+    using Type = std::remove_cvref_t<decltype(*std::declval<Vector&>().data())>;
+
+    BinaryVectorHeader header = read_binary_header<Type>(in);
+
+    Vector result(alloc);
+    read_elements(in, result, header.size);
+    if (in.get_remaining() != 0)
+    {
+        throw std::runtime_error("Binary vector header is corrupted");
+    }
+    return result;
+}
+
+//     O(N)
+template <typename Vector>
+Vector read_binary(std::istream& in, const typename Vector::allocator_type& alloc = typename Vector::allocator_type())
+{
+    BinaryInput input(in);
+    return read_binary<Vector>(input, alloc);
+}
+
+//     ,   ,     O(N)
+template <typename Vector>
+Vector read_binary(int fd, const typename Vector::allocator_type& alloc = typename Vector::allocator_type())
+{
+    BinaryInput input(fd);
+    return read_binary<Vector>(input, alloc);
+}
+
+//       .      Type
+//  ,   .      O(1)
+template <typename Type>
+std::span<const Type> view_binary(const void* buffer, size_t bytes)
+{
+    static_assert(BinaryCodec<Type>::kRaw, "Only raw binary vectors can be viewed without copying");
+
+    if (bytes < sizeof(BinaryVectorHeader))
+    {
+        throw std::runtime_error("Binary vector buffer is truncated");
+    }
+
+    BinaryVectorHeader header;
+    std::memcpy(&header, buffer, sizeof(header));
+    check_binary_header<Type>(header);
+
+    if (header.payload_bytes > bytes - sizeof(BinaryVectorHeader))
+    {
+        throw std::runtime_error("Binary vector buffer is truncated");
+    }
+
+    const char* payload = static_cast<const char*>(buffer) + sizeof(BinaryVectorHeader);
+    if (reinterpret_cast<uintptr_t>(payload) % alignof(Type) != 0)
+    {
+        throw std::runtime_error("Binary vector buffer is misaligned");
+    }
+    return std::span<const Type>(reinterpret_cast<const Type*>(payload), static_cast<size_t>(header.size));
+}
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+//     .     SIMPLE_VECTOR_STATS,
+//         .      
+// ,      VECTOR_STATS_TAG("tag"),    
+
+#define VECTOR_STATS_CONCAT_INTERNAL(X, Y) X##Y
+#define VECTOR_STATS_CONCAT(X, Y) VECTOR_STATS_CONCAT_INTERNAL(X, Y)
+#define VECTOR_STATS_TAG(tag) VectorStatsTag VECTOR_STATS_CONCAT(vectorStatsTag, __LINE__)(tag)
+
+#if defined(SIMPLE_VECTOR_STATS)
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <utility>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+//   
+struct VectorStatsCounters
+{
+    std::atomic<size_t> allocations{ 0 };
+    std::atomic<size_t> allocated_bytes{ 0 };
+    std::atomic<size_t> reallocations{ 0 };
+    std::atomic<size_t> copied{ 0 };            //   
+    std::atomic<size_t> moved{ 0 };             //     
+    std::atomic<size_t> relocated{ 0 };         //   
+    std::atomic<size_t> peak_capacity_bytes{ 0 };
+    std::atomic<size_t> wasted_bytes{ 0 };      //  ( - )    
+    std::atomic<size_t> peak_wasted_bytes{ 0 };
+
+    //    value O(1)
+    static void update_peak(std::atomic<size_t>& peak, size_t value) noexcept
+    {
+        size_t current = peak.load(std::memory_order_relaxed);
+        while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+};
+
+//     
+class VectorStatsRegistry
+{
+public:
+
+    //   key,     O(log N)
+    static VectorStatsCounters& get(const std::string& key)
+    {
+        std::lock_guard lock(mutex());
+        return records()[key];
+    }
+
+    //  ,    ,  nullptr O(1)
+    static VectorStatsCounters*& current_tag() noexcept
+    {
+        thread_local VectorStatsCounters* tag = nullptr;
+        return tag;
+    }
+
+    //      O(N)
+    static void report(std::ostream& out)
+    {
+        std::lock_guard lock(mutex());
+
+        int width = 8;
+        for (const auto& [key, counters] : records())
+        {
+            width = std::max(width, static_cast<int>(key.size()) + 2);
+        }
+
+        out << std::left << std::setw(width) << "group" << std::right
+            << std::setw(10) << "allocs" << std::setw(14) << "bytes" << std::setw(10) << "reallocs"
+            << std::setw(12) << "copied" << std::setw(12) << "moved" << std::setw(12) << "relocated"
+            << std::setw(14) << "peak cap B" << std::setw(14) << "wasted B" << std::setw(14) << "peak waste B" << '\n';
+
+        for (const auto& [key, counters] : records())
+        {
+            out << std::left << std::setw(width) << key << std::right
+                << std::setw(10) << counters.allocations << std::setw(14) << counters.allocated_bytes
+                << std::setw(10) << counters.reallocations << std::setw(12) << counters.copied
+                << std::setw(12) << counters.moved << std::setw(12) << counters.relocated
+                << std::setw(14) << counters.peak_capacity_bytes << std::setw(14) << counters.wasted_bytes
+                << std::setw(14) << counters.peak_wasted_bytes << '\n';
+        }
+    }
+
+    //    ,    O(N)
+    static void reset()
+    {
+        std::lock_guard lock(mutex());
+        for (auto& [key, counters] : records())
+        {
+            for (std::atomic<size_t>* counter : { &counters.allocations, &counters.allocated_bytes, &counters.reallocations,
+                &counters.copied, &counters.moved, &counters.relocated, &counters.peak_capacity_bytes,
+                &counters.wasted_bytes, &counters.peak_wasted_bytes })
+            {
+                counter->store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //      
+    template <typename Type>
+    static std::string type_name()
+    {
+        const char* name = typeid(Type).name();
+#if __has_include(<cxxabi.h>)
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+        if (status == 0 && demangled)
+        {
+            std::string result = demangled;
+            std::free(demangled);
+            return result;
+        }
+#endif
+        return name;
+    }
+
+private:
+
+    static std::mutex& mutex()
+    {
+        static std::mutex instance;
+        return instance;
+    }
+
+    //  std::map  ,      
+    static std::map<std::string, VectorStatsCounters>& records()
+    {
+        static std::map<std::string, VectorStatsCounters> instance;
+        return instance;
+    }
+};
+
+// ,          tag.  
+class VectorStatsTag
+{
+public:
+
+    explicit VectorStatsTag(const std::string& tag)
+        : previous(std::exchange(VectorStatsRegistry::current_tag(), &VectorStatsRegistry::get(tag))){}
+
+    VectorStatsTag(const VectorStatsTag&) = delete;
+    VectorStatsTag& operator=(const VectorStatsTag&) = delete;
+
+    ~VectorStatsTag()
+    {
+        VectorStatsRegistry::current_tag() = previous;
+    }
+
+private:
+
+    VectorStatsCounters* previous;
+};
+
+//        Type
+template <typename Type>
+struct VectorStats
+{
+    //    count 
+    static void allocated(size_t count) noexcept
+    {
+        VectorStatsCounters& counters = get();
+        counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.allocated_bytes.fetch_add(count * sizeof(Type), std::memory_order_relaxed);
+        VectorStatsCounters::update_peak(counters.peak_capacity_bytes, count * sizeof(Type));
+    }
+
+    //      
+    static void reallocated() noexcept
+    {
+        get().reallocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void copied(size_t count) noexcept
+    {
+        get().copied.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void moved(size_t count) noexcept
+    {
+        get().moved.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void relocated(size_t count) noexcept
+    {
+        get().relocated.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    //     capacity ,    size
+    static void released(size_t capacity, size_t size) noexcept
+    {
+        VectorStatsCounters& counters = get();
+        size_t wasted = (capacity - size) * sizeof(Type);
+        counters.wasted_bytes.fetch_add(wasted, std::memory_order_relaxed);
+        VectorStatsCounters::update_peak(counters.peak_wasted_bytes, wasted);
+    }
+
+private:
+
+    //       O(1)
+    static VectorStatsCounters& get() noexcept
+    {
+        if (VectorStatsCounters* tag = VectorStatsRegistry::current_tag())
+        {
+            return *tag;
+        }
+        static VectorStatsCounters& counters = VectorStatsRegistry::get(VectorStatsRegistry::type_name<Type>());
+        return counters;
+    }
+};
+
+#else
+
+//  SIMPLE_VECTOR_STATS    
+class VectorStatsRegistry
+{
+public:
+
+    static void report(std::ostream& out)
+    {
+        out << "Vector statistics are disabled, define SIMPLE_VECTOR_STATS to collect them\n";
+    }
+
+    static void reset() noexcept {}
+};
+
+class VectorStatsTag
+{
+public:
+
+    template <typename Tag>
+    explicit VectorStatsTag(const Tag&) noexcept {}
+};
+
+template <typename Type>
+struct VectorStats
+{
+    static void allocated(size_t) noexcept {}
+    static void reallocated() noexcept {}
+    static void copied(size_t) noexcept {}
+    static void moved(size_t) noexcept {}
+    static void relocated(size_t) noexcept {}
+    static void released(size_t, size_t) noexcept {}
+};
+
+#endif